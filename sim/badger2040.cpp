@@ -0,0 +1,337 @@
+// Badger2040 stand-in. Text is drawn with a 5x7 font sized to roughly match the
+// hershey and bitmap fonts, so layouts and costs are close but not pixel exact.
+
+#include <cstring>
+
+#include "badger2040.hpp"
+#include "font5x7.hpp"
+#include "sim.hpp"
+
+#define PIXEL_NS 150
+#define GLYPH_NS (20ull * 1000)
+#define MEASURE_NS (2ull * 1000)
+#define SPI_BYTE_NS 670
+#define REFRESH_MA 6.0
+// how long a press made while awake stays down
+#define PRESS_NS (100ull * 1000 * 1000)
+
+namespace {
+  const uint32_t refresh_ms[] = {4500, 2000, 800, 250};
+
+  struct Refresh {
+    uint64_t from_ns;
+    uint64_t to_ns;
+    double ma;
+  } refreshes[32];
+  uint32_t refresh_count = 0;
+
+  uint64_t busy_until_ns = 0;
+  uint64_t render_ns = 0;
+  uint32_t held_buttons = 0;
+  uint64_t held_until_ns = 0;
+  uint32_t frame_index = 0;
+
+  // drawing time is reported per refreshed frame rather than per call
+  void charge_render(uint64_t pixels, uint64_t extra_ns = 0) {
+    uint64_t ns = pixels * PIXEL_NS + extra_ns;
+    render_ns += ns;
+    sim_advance_ns(ns);
+  }
+
+  bool has_glyph(unsigned char c) {
+    if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+    return c >= 0x20 && c <= 0x5f;
+  }
+
+  void dump_frame(const uint8_t *frame_buffer) {
+    if (!sim->pbm_dir[0]) return;
+    char path[320];
+    snprintf(path, sizeof(path), "%s/wake%04u-%02u.pbm", sim->pbm_dir, sim->wake_index, frame_index++);
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+    fprintf(f, "P4\n296 128\n");
+    for (int y = 0; y < 128; ++y) {
+      uint8_t row[296 / 8] = {};
+      for (int x = 0; x < 296; ++x) {
+        if (frame_buffer[(y / 8) + x * 16] & (0x80 >> (y & 7))) row[x / 8] |= 0x80 >> (x & 7);
+      }
+      fwrite(row, 1, sizeof(row), f);
+    }
+    fclose(f);
+  }
+}
+
+double sim_panel_charge_mas(uint64_t from, uint64_t to) {
+  double charge = 0;
+  for (uint32_t i = 0; i < refresh_count; ++i) {
+    uint64_t a = refreshes[i].from_ns > from ? refreshes[i].from_ns : from;
+    uint64_t b = refreshes[i].to_ns < to ? refreshes[i].to_ns : to;
+    if (b > a) charge += refreshes[i].ma * (b - a) / 1e9;
+  }
+  return charge;
+}
+
+uint64_t sim_panel_idle_ns() {
+  return busy_until_ns;
+}
+
+namespace pimoroni {
+
+  void UC8151::pixel(int x, int y, int v) {
+    if (x < 0 || y < 0 || x >= width || y >= height) return;
+    uint8_t *p = &frame_buffer[(y / 8) + (x * (height / 8))];
+    uint8_t o = 7 - (y & 0b111);
+    *p = (*p & ~(1 << o)) | ((v == 0 ? 0 : 1) << o);
+  }
+
+  bool UC8151::is_busy() {
+    return sim->now_ns < busy_until_ns;
+  }
+
+  void UC8151::refresh(int x, int y, int w, int h, bool blocking) {
+    if (is_busy()) sim_advance_ns(busy_until_ns - sim->now_ns);
+    if (sim->reading_ns) {
+      sim_phase(SIM_PHASE_READING_TO_REFRESH, sim->now_ns - sim->reading_ns);
+      sim->reading_ns = 0;
+    }
+    if (sim->press_ns) {
+      sim_phase(SIM_PHASE_PRESS_TO_REFRESH, sim->now_ns - sim->press_ns);
+      sim->press_ns = 0;
+    }
+
+    sim_phase(SIM_PHASE_RENDER, render_ns);
+    render_ns = 0;
+
+    sim_advance_ns((uint64_t) w * h / 8 * SPI_BYTE_NS);
+    dump_frame(frame_buffer);
+
+    uint64_t duration_ns = (uint64_t) update_time() * 1000 * 1000;
+    bool partial = w != width || h != height;
+    sim_phase(partial ? SIM_PHASE_PARTIAL_UPDATE : SIM_PHASE_UPDATE, duration_ns);
+    ++(partial ? sim->partial_update_count : sim->update_count);
+
+    // the waveform runs for the same time either way, but a small window drives fewer pixels
+    double area = (double) (w * h) / (width * height);
+    if (refresh_count == sizeof(refreshes) / sizeof(refreshes[0])) refresh_count = 0;
+    refreshes[refresh_count++] = {sim->now_ns, sim->now_ns + duration_ns, REFRESH_MA * (area < 0.3 ? 0.3 : area)};
+    busy_until_ns = sim->now_ns + duration_ns;
+
+    if (!sim->painted) {
+      sim->painted = true;
+      sim_phase(SIM_PHASE_WAKE_TO_PAINT, busy_until_ns - sim->wake_ns);
+    }
+
+    if (blocking) sim_advance_ns(duration_ns);
+  }
+
+  void UC8151::update(bool blocking) {
+    refresh(0, 0, width, height, blocking);
+  }
+
+  void UC8151::partial_update(int x, int y, int w, int h, bool blocking) {
+    if (y % 8 || h % 8) {
+      fprintf(stderr, "partial_update: y and h must be multiples of 8 (y=%d h=%d)\n", y, h);
+      abort();
+    }
+    refresh(x, y, w, h, blocking);
+  }
+
+  void UC8151::update_speed(uint8_t speed) {
+    this->speed = speed < 4 ? speed : 3;
+  }
+
+  uint32_t UC8151::update_time() {
+    return refresh_ms[speed];
+  }
+
+  void Badger2040::init() {
+    _wake_button_states = sim->wake_buttons;
+    _button_states = sim->wake_buttons;
+  }
+
+  void Badger2040::update(bool blocking) {
+    uc8151.update(blocking);
+  }
+
+  void Badger2040::partial_update(int x, int y, int w, int h, bool blocking) {
+    uc8151.partial_update(x, y, w, h, blocking);
+  }
+
+  void Badger2040::update_speed(uint8_t speed) {
+    uc8151.update_speed(speed);
+  }
+
+  uint32_t Badger2040::update_time() {
+    return uc8151.update_time();
+  }
+
+  void Badger2040::halt() {
+    sim_halt();
+  }
+
+  bool Badger2040::is_busy() {
+    return uc8151.is_busy();
+  }
+
+  void Badger2040::led(uint8_t brightness) {
+  }
+
+  void Badger2040::font(std::string name) {
+    if (name == "sans" || name == "sans_bold" || name == "gothic" || name == "cursive" || name == "cursive_bold" ||
+        name == "serif" || name == "serif_bold" || name == "serif_italic") {
+      _vector_font = true;
+    } else if (name == "bitmap6" || name == "bitmap8") {
+      _vector_font = false;
+      _font_scale = 1;
+    } else if (name == "bitmap14_outline") {
+      _vector_font = false;
+      _font_scale = 2;
+    }
+  }
+
+  void Badger2040::pen(uint8_t pen) {
+    _pen = pen;
+  }
+
+  void Badger2040::thickness(uint8_t thickness) {
+    _thickness = thickness;
+  }
+
+  int Badger2040::dither(int32_t x, int32_t y) {
+    static const uint8_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+    if (_pen == 0) return 1;
+    if (_pen >= 15) return 0;
+    return _pen <= bayer[y & 3][x & 3] ? 1 : 0;
+  }
+
+  void Badger2040::clear() {
+    uint8_t *buf = uc8151.get_frame_buffer();
+    const uint32_t len = 296 * 128 / 8;
+    if (_pen == 0 || _pen >= 15) {
+      memset(buf, _pen == 0 ? 0xff : 0x00, len);
+      charge_render(0, len);
+      return;
+    }
+    for (int32_t x = 0; x < 296; ++x) {
+      for (int32_t y = 0; y < 128; ++y) uc8151.pixel(x, y, dither(x, y));
+    }
+    charge_render(296 * 128);
+  }
+
+  void Badger2040::pixel(int32_t x, int32_t y) {
+    uc8151.pixel(x, y, dither(x, y));
+    charge_render(1);
+  }
+
+  void Badger2040::line(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2;
+    int32_t dy = y2 > y1 ? y1 - y2 : y2 - y1;
+    int32_t sx = x1 < x2 ? 1 : -1;
+    int32_t sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t half = _thickness / 2;
+    uint64_t pixels = 0;
+
+    while (true) {
+      for (int32_t ox = -half; ox < _thickness - half; ++ox) {
+        for (int32_t oy = -half; oy < _thickness - half; ++oy) {
+          uc8151.pixel(x1 + ox, y1 + oy, dither(x1 + ox, y1 + oy));
+          ++pixels;
+        }
+      }
+      if (x1 == x2 && y1 == y2) break;
+      int32_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x1 += sx; }
+      if (e2 <= dx) { err += dx; y1 += sy; }
+    }
+    charge_render(pixels);
+  }
+
+  void Badger2040::rectangle(int32_t x, int32_t y, int32_t w, int32_t h) {
+    for (int32_t py = y; py < y + h; ++py) {
+      for (int32_t px = x; px < x + w; ++px) uc8151.pixel(px, py, dither(px, py));
+    }
+    charge_render((uint64_t) (w > 0 ? w : 0) * (h > 0 ? h : 0));
+  }
+
+  void Badger2040::image(const uint8_t *data) {
+    image(data, 296, 128, 0, 0);
+  }
+
+  void Badger2040::image(const uint8_t *data, int w, int h, int x, int y) {
+    for (int dy = 0; dy < h; ++dy) {
+      for (int dx = 0; dx < w; ++dx) {
+        uint32_t o = (dy * (w >> 3)) + (dx >> 3);
+        uint8_t m = 0b10000000 >> (dx & 0b111);
+        uc8151.pixel(x + dx, y + dy, data[o] & m);
+      }
+    }
+    charge_render((uint64_t) w * h);
+  }
+
+  // vector fonts are centred on y like hershey glyphs, bitmap fonts hang from it
+  int32_t Badger2040::glyph(unsigned char c, int32_t x, int32_t y, int32_t k) {
+    if (!has_glyph(c)) return 0;
+    if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+
+    int32_t top = _vector_font ? y - (7 * k) / 2 : y;
+    uint64_t pixels = 0;
+    for (int32_t col = 0; col < 5; ++col) {
+      uint8_t bits = font5x7[c - 0x20][col];
+      for (int32_t row = 0; row < 7; ++row) {
+        if (!(bits & (1 << row))) continue;
+        for (int32_t px = 0; px < k; ++px) {
+          for (int32_t py = 0; py < k; ++py) {
+            uc8151.pixel(x + col * k + px, top + row * k + py, dither(x + col * k + px, top + row * k + py));
+          }
+        }
+        pixels += k * k;
+      }
+    }
+    charge_render(pixels * (_vector_font ? _thickness : 1), GLYPH_NS);
+    return 5 * k;
+  }
+
+  void Badger2040::text(std::string message, int32_t x, int32_t y, float s, float a, uint8_t letter_spacing) {
+    int32_t k = _vector_font ? (int32_t) (3 * s + 0.5f) : (int32_t) (_font_scale * s + 0.5f);
+    if (k < 1) k = 1;
+    for (unsigned char c : message) {
+      int32_t advance = glyph(c, x, y, k);
+      if (advance) x += advance + letter_spacing * k;
+    }
+  }
+
+  int32_t Badger2040::measure_text(std::string message, float s, uint8_t letter_spacing) {
+    int32_t k = _vector_font ? (int32_t) (3 * s + 0.5f) : (int32_t) (_font_scale * s + 0.5f);
+    if (k < 1) k = 1;
+    int32_t width = 0;
+    for (unsigned char c : message) {
+      if (has_glyph(c)) width += (5 + letter_spacing) * k;
+    }
+    charge_render(0, MEASURE_NS * message.size());
+    return width;
+  }
+
+  // presses that come due while we're awake are held down for a moment
+  void Badger2040::update_button_states() {
+    if (sim_next_press_ns() <= sim->now_ns) {
+      held_buttons = sim_take_press();
+      if (!sim->press_ns) sim->press_ns = sim->now_ns;
+      held_until_ns = sim->now_ns + PRESS_NS;
+    }
+    _button_states = sim->now_ns < held_until_ns ? held_buttons : 0;
+  }
+
+  uint32_t Badger2040::button_states() {
+    return _button_states;
+  }
+
+  bool Badger2040::pressed(uint8_t button) {
+    return (_button_states & (1 << button)) != 0;
+  }
+
+  bool Badger2040::pressed_to_wake(uint8_t button) {
+    return (_wake_button_states & (1 << button)) != 0;
+  }
+
+}
@@ -0,0 +1,113 @@
+// Host microbenchmark for the framebuffer kernels against the pixel by pixel
+// path the Badger2040 drawing calls take. Checks the two agree first, on
+// random shapes, then times each on the shapes the screens actually draw.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+#include "framebuffer.hpp"
+
+#define BAND_COUNT (DISPLAY_HEIGHT / 8)
+#define FRAME_BYTES (DISPLAY_WIDTH * BAND_COUNT)
+
+namespace {
+  uint8_t frame[FRAME_BYTES];
+  uint8_t expected[FRAME_BYTES];
+  uint8_t image[DISPLAY_HEIGHT * DISPLAY_WIDTH / 8];
+
+  // same as UC8151::pixel
+  void pixel(uint8_t *frame_buffer, int x, int y, bool black) {
+    if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+    uint8_t *p = &frame_buffer[(y / 8) + x * BAND_COUNT];
+    uint8_t o = 7 - (y & 7);
+    *p = (*p & ~(1 << o)) | (black << o);
+  }
+
+  void pixel_clear(uint8_t *frame_buffer, bool black) {
+    for (int x = 0; x < DISPLAY_WIDTH; ++x) {
+      for (int y = 0; y < DISPLAY_HEIGHT; ++y) pixel(frame_buffer, x, y, black);
+    }
+  }
+
+  void pixel_fill_rect(uint8_t *frame_buffer, int x, int y, int w, int h, bool black) {
+    for (int py = y; py < y + h; ++py) {
+      for (int px = x; px < x + w; ++px) pixel(frame_buffer, px, py, black);
+    }
+  }
+
+  void pixel_or_rows(uint8_t *frame_buffer, const uint8_t *rows, int stride, int x, int y, int h) {
+    for (int row = 0; row < h; ++row) {
+      for (int px = 0; px < stride * 8; ++px) {
+        if (rows[row * stride + px / 8] & (0x80 >> (px & 7))) pixel(frame_buffer, x + px, y + row, true);
+      }
+    }
+  }
+
+  void scramble(uint8_t *frame_buffer) {
+    for (int i = 0; i < FRAME_BYTES; ++i) frame_buffer[i] = rand();
+  }
+
+  bool check() {
+    srand(1);
+    for (int n = 0; n < 10000; ++n) {
+      scramble(frame);
+      memcpy(expected, frame, FRAME_BYTES);
+      int x = rand() % 360 - 32, y = rand() % 160 - 16, w = rand() % 320, h = rand() % 150;
+      bool black = rand() & 1;
+      if (n % 2) {
+        fb_fill_rect(frame, x, y, w, h, black);
+        pixel_fill_rect(expected, x, y, w, h, black);
+      } else {
+        int stride = 1 + rand() % (DISPLAY_WIDTH / 8);
+        h = 1 + h % DISPLAY_HEIGHT;
+        for (int i = 0; i < stride * h; ++i) image[i] = rand() % 3 ? 0 : rand();
+        fb_or_rows(frame, image, stride, x, y, h);
+        pixel_or_rows(expected, image, stride, x, y, h);
+      }
+      if (memcmp(frame, expected, FRAME_BYTES)) {
+        fprintf(stderr, "mismatch on case %d: %s at %d,%d %dx%d\n", n, n % 2 ? "fill" : "or", x, y, w, h);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  double ns_per_call(const std::function<void()> &call) {
+    int iterations = 1;
+    while (true) {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i) call();
+      std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+      if (elapsed.count() > 2e8) return elapsed.count() / iterations;
+      iterations *= 2;
+    }
+  }
+
+  void compare(const char *name, const std::function<void()> &kernel, const std::function<void()> &per_pixel) {
+    double fast = ns_per_call(kernel), slow = ns_per_call(per_pixel);
+    printf("%-28s %12.1f %12.1f %9.1fx\n", name, fast, slow, slow / fast);
+  }
+}
+
+int main() {
+  if (!check()) return 1;
+  printf("kernels match the per-pixel path on 10000 random shapes\n\n");
+
+  // roughly the badge: mostly white with some solid areas
+  for (int i = 0; i < (int) sizeof(image); ++i) image[i] = (i / 37) % 16 < 4 ? 0xff : (i % 5 ? 0 : 0x3c);
+
+  printf("%-28s %12s %12s %10s\n", "", "kernel ns", "per-pixel ns", "speedup");
+  compare("clear", [] { fb_clear(frame, false); }, [] { pixel_clear(frame, false); });
+  compare("reading box 37x27 at 2,100", [] { fb_fill_rect(frame, 2, 100, 37, 27, false); },
+          [] { pixel_fill_rect(frame, 2, 100, 37, 27, false); });
+  compare("unaligned box 65x19 at 3,5", [] { fb_fill_rect(frame, 3, 5, 65, 19, true); },
+          [] { pixel_fill_rect(frame, 3, 5, 65, 19, true); });
+  compare("full screen image", [] { fb_or_rows(frame, image, DISPLAY_WIDTH / 8, 0, 0, DISPLAY_HEIGHT); },
+          [] { pixel_or_rows(frame, image, DISPLAY_WIDTH / 8, 0, 0, DISPLAY_HEIGHT); });
+  compare("unaligned image 64x40", [] { fb_or_rows(frame, image, 8, 13, 21, 40); },
+          [] { pixel_or_rows(frame, image, 8, 13, 21, 40); });
+  return 0;
+}
@@ -0,0 +1,181 @@
+// Core0 runs on the host's own thread against the virtual clock. Burning time
+// or waiting for an event moves the clock on, and the timer alarms and gpio
+// edges that come due on the way are delivered as interrupts in between, so
+// the interleaving is deterministic.
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "sim.hpp"
+
+namespace {
+  // the event flag that lets the next __wfe fall through
+  bool event = false;
+  bool deep_sleep = false;
+
+  struct Alarm {
+    bool claimed;
+    bool armed;
+    uint64_t target_us;
+    hardware_alarm_callback_t callback;
+  };
+
+  Alarm alarms[4];
+  // an interrupt handler is running, they don't nest
+  bool in_interrupt = false;
+
+  // a timer alarm, or a gpio edge while gpio is true
+  struct Interrupt {
+    bool gpio;
+    int alarm;
+    uint64_t at_ns;
+  };
+
+  void advance_clock(uint64_t to) {
+    if (to <= sim->now_ns) return;
+    uint64_t from = sim->now_ns;
+    sim->charge_mas += (deep_sleep ? SIM_MCU_SLEEP_MA : SIM_MCU_AWAKE_MA) * (to - from) / 1e9;
+    sim->charge_mas += sim_panel_charge_mas(from, to);
+    sim->charge_mas += sim_sensor_charge_mas(from, to);
+    if (deep_sleep) sim->timer_paused_ns += to - from;
+    sim->now_ns = to;
+
+    if (!deep_sleep && sim->now_ns - sim->wake_ns > sim->max_awake_ns) {
+      ++sim->timeouts;
+      sim_phase(SIM_PHASE_AWAKE, sim->now_ns - sim->wake_ns);
+      fflush(stdout);
+      _exit(0);
+    }
+  }
+
+  // the timer runs from boot and stops while we deep sleep
+  uint64_t alarm_ns(const Alarm &alarm) {
+    return sim->boot_ns + sim->timer_paused_ns + alarm.target_us * 1000;
+  }
+
+  // the interrupt we take first on the way to until, if any
+  bool due_interrupt(uint64_t until, Interrupt *due) {
+    if (in_interrupt) return false;
+    *due = {false, -1, until};
+    for (int i = 0; i < 4; ++i) {
+      if (!alarms[i].armed || alarm_ns(alarms[i]) > due->at_ns) continue;
+      if (due->alarm < 0 || alarm_ns(alarms[i]) < due->at_ns) *due = {false, i, alarm_ns(alarms[i])};
+    }
+    uint64_t edge_ns;
+    if (sim_next_gpio_irq(&edge_ns) && edge_ns <= due->at_ns && (due->alarm < 0 || edge_ns < due->at_ns)) {
+      *due = {true, -1, edge_ns};
+    }
+    if (!due->gpio && due->alarm < 0) return false;
+    // anything already pending goes in straight away
+    if (due->at_ns < sim->now_ns) due->at_ns = sim->now_ns;
+    return true;
+  }
+
+  void fire(const Interrupt &due) {
+    hardware_alarm_callback_t callback = nullptr;
+    if (!due.gpio) {
+      alarms[due.alarm].armed = false;
+      callback = alarms[due.alarm].callback;
+      if (!callback) return;
+    }
+    in_interrupt = true;
+    if (due.gpio) {
+      sim_gpio_irq();
+    } else {
+      callback(due.alarm);
+    }
+    in_interrupt = false;
+  }
+}
+
+void sim_advance_ns(uint64_t ns) {
+  uint64_t until = sim->now_ns + ns;
+  for (Interrupt due; due_interrupt(until, &due);) {
+    advance_clock(due.at_ns);
+    fire(due);
+  }
+  advance_clock(until);
+}
+
+uint get_core_num() {
+  return 0;
+}
+
+void sim_sleep_until(uint64_t ns, bool deep) {
+  deep_sleep = deep;
+  advance_clock(ns);
+  deep_sleep = false;
+}
+
+void __wfe() {
+  if (event) {
+    event = false;
+    return;
+  }
+  Interrupt due;
+  if (!due_interrupt(UINT64_MAX, &due)) {
+    // nothing can ever wake us, which is as good as powered off
+    sim_halt();
+  }
+  advance_clock(due.at_ns);
+  fire(due);
+}
+
+void __sev() {
+  event = true;
+}
+
+int hardware_alarm_claim_unused(bool required) {
+  for (int i = 0; i < 4; ++i) {
+    if (alarms[i].claimed) continue;
+    alarms[i].claimed = true;
+    return i;
+  }
+  if (required) {
+    fprintf(stderr, "hardware_alarm_claim_unused: no alarms left\n");
+    abort();
+  }
+  return -1;
+}
+
+void hardware_alarm_set_callback(uint alarm_num, hardware_alarm_callback_t callback) {
+  alarms[alarm_num].callback = callback;
+}
+
+bool hardware_alarm_set_target(uint alarm_num, absolute_time_t target) {
+  alarms[alarm_num].armed = target > time_us_64();
+  alarms[alarm_num].target_us = target;
+  return !alarms[alarm_num].armed;
+}
+
+void hardware_alarm_cancel(uint alarm_num) {
+  alarms[alarm_num].armed = false;
+}
+
+// the timer starts again from zero every time the board powers up
+absolute_time_t get_absolute_time() {
+  return time_us_64();
+}
+
+uint64_t time_us_64() {
+  return (sim->now_ns - sim->boot_ns - sim->timer_paused_ns) / 1000;
+}
+
+uint32_t time_us_32() {
+  return (uint32_t) time_us_64();
+}
+
+void sleep_us(uint64_t us) {
+  sim_advance_ns(us * 1000);
+}
+
+void sleep_ms(uint32_t ms) {
+  sim_advance_ns((uint64_t) ms * 1000 * 1000);
+}
+
+bool stdio_init_all() {
+  return true;
+}
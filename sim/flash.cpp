@@ -0,0 +1,44 @@
+// Flash stand-in with W25Q16JV typical timings. Like NOR flash, programming can
+// only clear bits, so code that skips an erase sees what the hardware would.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "hardware/flash.h"
+#include "sim.hpp"
+
+#define SECTOR_ERASE_NS (45ull * 1000 * 1000)
+#define PAGE_PROGRAM_NS (400ull * 1000)
+
+const uint8_t *sim_flash_memory() {
+  return sim->flash;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+  if (flash_offs % FLASH_SECTOR_SIZE || count % FLASH_SECTOR_SIZE || flash_offs + count > PICO_FLASH_SIZE_BYTES) {
+    fprintf(stderr, "flash_range_erase: bad range 0x%X+0x%zX\n", flash_offs, count);
+    abort();
+  }
+
+  memset(sim->flash + flash_offs, 0xff, count);
+  uint32_t sectors = count / FLASH_SECTOR_SIZE;
+  for (uint32_t i = 0; i < sectors; ++i) ++sim->sector_erases[flash_offs / FLASH_SECTOR_SIZE + i];
+
+  sim_phase(SIM_PHASE_FLASH_ERASE, sectors * SECTOR_ERASE_NS);
+  sim_advance_ns(sectors * SECTOR_ERASE_NS);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+  if (flash_offs % FLASH_PAGE_SIZE || count % FLASH_PAGE_SIZE || flash_offs + count > PICO_FLASH_SIZE_BYTES) {
+    fprintf(stderr, "flash_range_program: bad range 0x%X+0x%zX\n", flash_offs, count);
+    abort();
+  }
+
+  for (size_t i = 0; i < count; ++i) sim->flash[flash_offs + i] &= data[i];
+  ++sim->flash_programs;
+
+  uint32_t pages = count / FLASH_PAGE_SIZE;
+  sim_phase(SIM_PHASE_FLASH_PROGRAM, pages * PAGE_PROGRAM_NS);
+  sim_advance_ns(pages * PAGE_PROGRAM_NS);
+}
@@ -0,0 +1,93 @@
+#pragma once
+// simulator stand-in for pimoroni's Badger2040 library. Drawing goes into a real
+// 1bpp framebuffer laid out like the UC8151 driver's so screens can be dumped,
+// and every call costs the virtual time it would take on the RP2040.
+
+#include <string>
+
+#include "pico/stdlib.h"
+
+namespace pimoroni {
+
+  class UC8151 {
+  public:
+    UC8151(uint16_t width, uint16_t height) : width(width), height(height) {}
+
+    uint16_t width;
+    uint16_t height;
+
+    uint8_t *get_frame_buffer() { return frame_buffer; }
+    void pixel(int x, int y, int v);
+
+    bool is_busy();
+    void update(bool blocking = true);
+    void partial_update(int x, int y, int w, int h, bool blocking = true);
+    void update_speed(uint8_t speed);
+    uint32_t update_time();
+
+  private:
+    void refresh(int x, int y, int w, int h, bool blocking);
+
+    uint8_t frame_buffer[296 * 128 / 8] = {};
+    uint8_t speed = 0;
+  };
+
+  class Badger2040 {
+  protected:
+    UC8151 uc8151;
+    bool _vector_font = true;
+    uint8_t _font_scale = 1;
+    uint8_t _pen = 0;
+    uint8_t _thickness = 1;
+    uint32_t _button_states = 0;
+    uint32_t _wake_button_states = 0;
+
+  public:
+    Badger2040() : uc8151(296, 128) {}
+
+    void init();
+    void update(bool blocking = false);
+    void partial_update(int x, int y, int w, int h, bool blocking = false);
+    void update_speed(uint8_t speed);
+    uint32_t update_time();
+    void halt();
+    bool is_busy();
+
+    void led(uint8_t brightness);
+    void font(std::string name);
+    void pen(uint8_t pen);
+    void thickness(uint8_t thickness);
+
+    void clear();
+    void pixel(int32_t x, int32_t y);
+    void line(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+    void rectangle(int32_t x, int32_t y, int32_t w, int32_t h);
+    void image(const uint8_t *data);
+    void image(const uint8_t *data, int w, int h, int x, int y);
+
+    void text(std::string message, int32_t x, int32_t y, float s = 1.0f, float a = 0.0f, uint8_t letter_spacing = 1);
+    int32_t measure_text(std::string message, float s = 1.0f, uint8_t letter_spacing = 1);
+
+    void update_button_states();
+    uint32_t button_states();
+    bool pressed(uint8_t button);
+    bool pressed_to_wake(uint8_t button);
+
+    static const uint8_t A = 12;
+    static const uint8_t B = 13;
+    static const uint8_t C = 14;
+    static const uint8_t D = 15;
+    static const uint8_t E = 11;
+    static const uint8_t UP = 15;
+    static const uint8_t DOWN = 11;
+    static const uint8_t USER = 23;
+    static const uint8_t BUSY = 26;
+    static const uint8_t VBUS_DETECT = 24;
+    static const uint8_t BATTERY = 29;
+
+  private:
+    int32_t glyph(unsigned char c, int32_t x, int32_t y, int32_t k);
+    int dither(int32_t x, int32_t y);
+  };
+
+}
@@ -0,0 +1,10 @@
+#pragma once
+// simulator stand-in for hardware/adc.h, 12 bit conversions of the simulated
+// battery and the board's 1.24 V reference
+
+#include "pico/platform.h"
+
+void adc_init();
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+uint16_t adc_read();
@@ -0,0 +1,16 @@
+#pragma once
+// simulator stand-in for hardware/clocks.h, only the sleep clock gates
+
+#include "pico/platform.h"
+
+typedef struct {
+  volatile uint32_t sleep_en0;
+  volatile uint32_t sleep_en1;
+} clocks_hw_t;
+
+extern clocks_hw_t sim_clocks_hw;
+#define clocks_hw (&sim_clocks_hw)
+
+#define CLOCKS_SLEEP_EN0_CLK_RTC_RTC_BITS 0x00800000u
+#define CLOCKS_SLEEP_EN0_CLK_SYS_PADS_BITS 0x00000800u
+#define CLOCKS_SLEEP_EN0_CLK_SYS_IO_BITS 0x00000200u
@@ -0,0 +1,11 @@
+#pragma once
+// simulator stand-in for hardware/flash.h, erase and program cost virtual time
+
+#include "pico/platform.h"
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define FLASH_BLOCK_SIZE (1u << 16)
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
@@ -0,0 +1,25 @@
+#pragma once
+// simulator stand-in for hardware/gpio.h, only rising edge interrupts and the
+// few pins the firmware reads or drives itself
+
+#include "pico/platform.h"
+
+enum gpio_irq_level {
+  GPIO_IRQ_LEVEL_LOW = 0x1u,
+  GPIO_IRQ_LEVEL_HIGH = 0x2u,
+  GPIO_IRQ_EDGE_FALL = 0x4u,
+  GPIO_IRQ_EDGE_RISE = 0x8u,
+};
+
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback);
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled);
+
+#define GPIO_IN false
+#define GPIO_OUT true
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
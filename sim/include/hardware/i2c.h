@@ -0,0 +1,11 @@
+#pragma once
+// simulator stand-in for hardware/i2c.h, the only device on the bus is the SCD4x
+
+#include "pico/error.h"
+#include "pico/platform.h"
+
+typedef struct i2c_inst i2c_inst_t;
+
+// bytes transferred, or PICO_ERROR_GENERIC if the device doesn't acknowledge
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop, uint timeout_us);
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us);
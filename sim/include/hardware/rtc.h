@@ -0,0 +1,23 @@
+#pragma once
+// simulator stand-in for hardware/rtc.h, counts whole seconds of virtual time
+
+#include "pico/platform.h"
+
+typedef struct {
+  int16_t year;
+  int8_t month;
+  int8_t day;
+  int8_t dotw;
+  int8_t hour;
+  int8_t min;
+  int8_t sec;
+} datetime_t;
+
+typedef void (*rtc_callback_t)(void);
+
+void rtc_init();
+bool rtc_set_datetime(datetime_t *t);
+bool rtc_get_datetime(datetime_t *t);
+bool rtc_running();
+void rtc_set_alarm(datetime_t *t, rtc_callback_t user_callback);
+void rtc_disable_alarm();
@@ -0,0 +1,13 @@
+#pragma once
+// simulator stand-in for hardware/structs/scb.h, deep sleep is modelled on SLEEPDEEP
+
+#include "pico/platform.h"
+
+typedef struct {
+  volatile uint32_t scr;
+} armv6m_scb_hw_t;
+
+extern armv6m_scb_hw_t sim_scb_hw;
+#define scb_hw (&sim_scb_hw)
+
+#define M0PLUS_SCR_SLEEPDEEP_BITS 0x00000004u
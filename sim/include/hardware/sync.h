@@ -0,0 +1,18 @@
+#pragma once
+// simulator stand-in for hardware/sync.h
+
+#include "pico/platform.h"
+
+static inline uint32_t save_and_disable_interrupts() {
+  return 0;
+}
+
+static inline void restore_interrupts(uint32_t) {
+}
+
+// waits for the next wake source, a deep sleep if SLEEPDEEP is set
+void __wfi();
+// core events: __wfe returns at once if __sev has been called since the last
+// one, and otherwise waits for the next interrupt
+void __wfe();
+void __sev();
@@ -0,0 +1,14 @@
+#pragma once
+// simulator stand-in for hardware/timer.h. An alarm's callback runs on core0,
+// as its interrupt would, once core0's virtual time passes the target; like
+// the real timer, targets don't move while the chip is in deep sleep.
+
+#include "pico/time.h"
+
+typedef void (*hardware_alarm_callback_t)(uint alarm_num);
+
+int hardware_alarm_claim_unused(bool required);
+void hardware_alarm_set_callback(uint alarm_num, hardware_alarm_callback_t callback);
+// true, and nothing armed, if the target has already gone by
+bool hardware_alarm_set_target(uint alarm_num, absolute_time_t target);
+void hardware_alarm_cancel(uint alarm_num);
@@ -0,0 +1,19 @@
+#pragma once
+// simulator stand-in for the pico-sdk platform header
+
+#include <cstddef>
+#include <cstdint>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(func_name) func_name
+#define __time_critical_func(func_name) func_name
+
+// the flash image lives in the simulator, reads go through the fake XIP window
+const uint8_t *sim_flash_memory();
+#define XIP_BASE ((uintptr_t) sim_flash_memory())
+
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024)
+
+// which core the calling thread stands in for
+uint get_core_num();
@@ -0,0 +1,9 @@
+#pragma once
+// simulator stand-in for pico/stdlib.h
+
+#include <cstdio>
+
+#include "pico/platform.h"
+#include "pico/time.h"
+
+bool stdio_init_all();
@@ -0,0 +1,44 @@
+#pragma once
+// simulator stand-in for pico/time.h, all time is virtual
+
+#include "pico/platform.h"
+
+typedef uint64_t absolute_time_t;
+
+absolute_time_t get_absolute_time();
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+uint32_t time_us_32();
+uint64_t time_us_64();
+
+static inline uint64_t to_us_since_boot(absolute_time_t t) {
+  return t;
+}
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+  return (uint32_t)(t / 1000);
+}
+
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+  return (int64_t)(to - from);
+}
+
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) {
+  return t + us;
+}
+
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) {
+  return t + (uint64_t) ms * 1000;
+}
+
+static inline absolute_time_t make_timeout_time_us(uint64_t us) {
+  return delayed_by_us(get_absolute_time(), us);
+}
+
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) {
+  return delayed_by_ms(get_absolute_time(), ms);
+}
+
+static inline bool time_reached(absolute_time_t t) {
+  return get_absolute_time() >= t;
+}
@@ -0,0 +1,18 @@
+#pragma once
+// simulator stand-in for pimoroni's I2C wrapper, the bus is the one in hardware/i2c.h
+
+#include "hardware/i2c.h"
+#include "pico/stdlib.h"
+
+namespace pimoroni {
+  namespace BOARD {
+    enum Board { BREAKOUT_GARDEN, PICO_EXPLORER };
+  }
+
+  class I2C {
+  public:
+    I2C(BOARD::Board board) : board(board) {}
+    i2c_inst_t *get_i2c() { return nullptr; }
+    BOARD::Board board;
+  };
+}
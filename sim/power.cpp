@@ -0,0 +1,76 @@
+// Battery and USB stand-ins. The pack is two AAA alkaline cells that start at
+// battery_start_percent and lose every mA*s the simulator charges for, unless
+// the board is on USB. The ADC sees the battery through a divide by three and
+// the 1.24 V reference while it's switched on, both against the 3.3 V rail.
+
+#include "hardware/adc.h"
+#include "hardware/gpio.h"
+#include "badger2040.hpp"
+#include "sim.hpp"
+
+#define RAIL_MV 3300.0
+#define REF_1V2_MV 1240.0
+#define VREF_POWER 27
+#define ADC_MAX 4095
+
+namespace {
+  // at the badge's light load, every tenth from full down to flat
+  const double discharge_mv[] = {3200, 2900, 2760, 2660, 2560, 2480, 2400, 2320, 2240, 2100, 1800};
+  const int discharge_steps = sizeof(discharge_mv) / sizeof(discharge_mv[0]) - 1;
+
+  uint selected = 0;
+  bool driven[32];
+
+  uint16_t counts(double mv) {
+    double value = mv / RAIL_MV * ADC_MAX;
+    return value > ADC_MAX ? ADC_MAX : (uint16_t) value;
+  }
+}
+
+double sim_battery_percent() {
+  double percent = sim->battery_start_percent;
+  if (!sim->usb) percent -= sim->charge_mas / 36 / sim->battery_mah;
+  return percent > 0 ? percent : 0;
+}
+
+double sim_battery_mv() {
+  double tenths = (100 - sim_battery_percent()) / 10;
+  int step = (int) tenths;
+  if (step >= discharge_steps) return discharge_mv[discharge_steps];
+  double part = tenths - step;
+  return discharge_mv[step] + (discharge_mv[step + 1] - discharge_mv[step]) * part;
+}
+
+void adc_init() {
+}
+
+void adc_gpio_init(uint gpio) {
+}
+
+void adc_select_input(uint input) {
+  selected = input;
+}
+
+uint16_t adc_read() {
+  switch (selected) {
+    case pimoroni::Badger2040::BATTERY - 26: return counts(sim_battery_mv() / 3);
+    case 28 - 26: return driven[VREF_POWER] ? counts(REF_1V2_MV) : 0;
+    default: return 0;
+  }
+}
+
+void gpio_init(uint gpio) {
+  driven[gpio] = false;
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+}
+
+void gpio_put(uint gpio, bool value) {
+  driven[gpio] = value;
+}
+
+bool gpio_get(uint gpio) {
+  if (gpio == pimoroni::Badger2040::VBUS_DETECT) return sim->usb;
+  return driven[gpio];
+}
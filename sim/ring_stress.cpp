@@ -0,0 +1,136 @@
+// Host stress test for SpscRing. A producer and a consumer thread hammer one
+// ring with random batch sizes, first losslessly, the producer retrying until
+// everything fits, then through push_or_drop, where it never waits. Each item
+// carries its sequence number twice over, so the consumer can spot one that
+// is torn, repeated, out of order or made up, and at the end what arrived and
+// what was dropped have to add up to what was sent.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "spsc_ring.hpp"
+
+namespace {
+  // the size of a SensorSample
+  struct Item {
+    uint32_t sequence;
+    uint32_t check;
+    uint32_t inverse;
+  };
+
+  Item make_item(uint32_t sequence) {
+    return {sequence, sequence * 2654435761u, ~sequence};
+  }
+
+  bool intact(const Item &item) {
+    return item.check == item.sequence * 2654435761u && item.inverse == ~item.sequence;
+  }
+
+  struct Random {
+    uint32_t state;
+    uint32_t next(uint32_t below) {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state % below;
+    }
+  };
+
+  struct Result {
+    uint64_t received;
+    uint64_t missing;
+    uint64_t dropped;
+    uint64_t errors;
+    double seconds;
+  };
+
+  template <uint32_t N>
+  Result run(uint32_t count, bool lossless) {
+    auto ring = std::make_unique<SpscRing<Item, N>>();
+    std::atomic<bool> done{false};
+    Result result = {};
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+      Random random = {0x9e3779b9u};
+      Item batch[N];
+      uint32_t sequence = 0;
+      while (sequence < count) {
+        uint32_t size = 1 + random.next(N / 2);
+        if (size > count - sequence) size = count - sequence;
+        for (uint32_t i = 0; i < size; ++i) batch[i] = make_item(sequence + i);
+        if (lossless) {
+          uint32_t sent = 0;
+          while (sent < size) sent += ring->push(batch + sent, size - sent);
+        } else {
+          ring->push_or_drop(batch, size);
+        }
+        sequence += size;
+      }
+      done.store(true, std::memory_order_release);
+    });
+
+    std::thread consumer([&] {
+      Random random = {0x85ebca6bu};
+      Item batch[2 * N];
+      uint32_t expected = 0;
+      while (true) {
+        bool finished = done.load(std::memory_order_acquire);
+        uint32_t got = ring->pop(batch, 1 + random.next(2 * N));
+        if (!got && finished) break;
+        for (uint32_t i = 0; i < got; ++i) {
+          const Item &item = batch[i];
+          if (!intact(item) || item.sequence < expected || (lossless && item.sequence != expected)) {
+            ++result.errors;
+            continue;
+          }
+          result.missing += item.sequence - expected;
+          expected = item.sequence + 1;
+          ++result.received;
+        }
+      }
+      result.missing += count - expected;
+    });
+
+    producer.join();
+    consumer.join();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.dropped = ring->dropped();
+    return result;
+  }
+
+  template <uint32_t N>
+  bool report(const char *name, uint32_t count, bool lossless) {
+    Result result = run<N>(count, lossless);
+    bool ok = !result.errors && result.missing == result.dropped && result.received + result.dropped == count &&
+              (!lossless || !result.dropped);
+    printf("%-22s %5u %10llu %10llu %8llu %8.1f  %s\n", name, N, (unsigned long long) result.received,
+           (unsigned long long) result.dropped, (unsigned long long) result.errors,
+           result.received / result.seconds / 1e6, ok ? "ok" : "FAILED");
+    return ok;
+  }
+}
+
+int main(int argc, char **argv) {
+  // On one core the threads only take turns at the scheduler's tick, so there
+  // it's a check that nothing goes missing rather than a hammering.
+  bool one_core = std::thread::hardware_concurrency() < 2;
+  uint32_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : one_core ? 20000 : 10000000;
+  if (one_core) printf("one core, the threads take turns rather than race\n");
+  if (!count) {
+    fprintf(stderr, "usage: %s [items per run]\n", argv[0]);
+    return 1;
+  }
+
+  printf("%-22s %5s %10s %10s %8s %8s\n", "run", "slots", "received", "dropped", "errors", "M/s");
+  bool ok = true;
+  ok &= report<32>("lossless", count, true);
+  ok &= report<32>("drop when full", count, false);
+  ok &= report<1024>("lossless", count, true);
+  ok &= report<1024>("drop when full", count, false);
+  return ok ? 0 : 1;
+}
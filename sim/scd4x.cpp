@@ -0,0 +1,285 @@
+// SCD4x stand-in on the I2C bus. It speaks the datasheet's protocol, command
+// words with CRC-8 on every argument and response word, and like the real
+// part it doesn't acknowledge anything while a command is executing. Command
+// execution times and currents follow the SCD41 datasheet; readings come from
+// a synthetic room that fills up for an hour every three hours and airs out in
+// between.
+
+#include <cmath>
+#include <cstring>
+
+#include "hardware/i2c.h"
+#include "sim.hpp"
+
+#define ADDRESS 0x62
+// 9 clocks a byte at 400 kHz, plus the address byte
+#define BYTE_NS (9ull * 2500)
+#define PERIODIC_INTERVAL_NS (5000ull * 1000 * 1000)
+#define LOW_POWER_INTERVAL_NS (30000ull * 1000 * 1000)
+#define SINGLE_SHOT_NS (5000ull * 1000 * 1000)
+#define SINGLE_SHOT_RHT_NS (50ull * 1000 * 1000)
+
+namespace {
+  enum Mode { Idle, Periodic, LowPowerPeriodic, SingleShot, PowerDown };
+
+  struct Sensor {
+    Mode mode = Idle;
+    uint64_t started_ns = 0;
+    uint64_t interval_ns = 0;
+    uint64_t consumed = 0;
+    uint64_t waiting_since_ns = 0;
+    bool rht_only = false;
+    uint16_t co2 = 0;
+    // nothing gets an acknowledge before the last command has executed
+    uint64_t busy_until_ns = 0;
+    uint8_t response[9];
+    uint8_t response_length = 0;
+  } sensor;
+
+  struct ModeChange {
+    uint64_t at_ns;
+    Mode mode;
+    uint64_t busy_until_ns;
+  } history[64];
+  uint32_t history_len = 0;
+
+  double mode_ma(Mode mode) {
+    switch (mode) {
+      case Periodic: return 15.0;
+      case LowPowerPeriodic: return 3.2;
+      case PowerDown: return 0.0005;
+      default: return 0.2;
+    }
+  }
+
+  void set_mode(Mode mode, uint64_t busy_ns = 0) {
+    sensor.mode = mode;
+    sensor.started_ns = sim->now_ns;
+    sensor.consumed = 0;
+    sensor.waiting_since_ns = sim->now_ns;
+    if (history_len == sizeof(history) / sizeof(history[0])) {
+      history[0] = history[history_len - 1];
+      history_len = 1;
+    }
+    history[history_len++] = {sim->now_ns, mode, sim->now_ns + busy_ns};
+  }
+
+  uint32_t noise(uint64_t n) {
+    n ^= n >> 33;
+    n *= 0xff51afd7ed558ccdull;
+    n ^= n >> 33;
+    n *= 0xc4ceb9fe1a85ec53ull;
+    n ^= n >> 33;
+    return (uint32_t) n;
+  }
+
+  double jitter(uint64_t t_ns, uint64_t salt, double amplitude) {
+    return amplitude * ((noise(t_ns / 1000000 * 31 + salt) % 2001) / 1000.0 - 1.0);
+  }
+
+  double room_co2(uint64_t t_ns) {
+    const double meeting_s = 3600, cycle_s = 3 * 3600;
+    double p = fmod(t_ns / 1e9, cycle_s);
+    if (p < meeting_s) return 420 + 1100 * (1 - exp(-p / 1200));
+    double peak = 1100 * (1 - exp(-meeting_s / 1200));
+    return 420 + peak * exp(-(p - meeting_s) / 2400);
+  }
+
+  void sample(uint64_t t_ns, uint16_t *co2, int32_t *temperature, int32_t *humidity) {
+    double c = room_co2(t_ns);
+    double occupancy = (c - 420) / 1100;
+    double t = 21.0 + 1.5 * occupancy + 0.3 * sin(t_ns / 1e9 / 7200) + jitter(t_ns, 1, 0.05);
+    double h = 45.0 + 10.0 * occupancy + jitter(t_ns, 2, 0.3);
+    if (!sensor.rht_only) sensor.co2 = (uint16_t) (c + jitter(t_ns, 3, 10));
+    *co2 = sensor.co2;
+    *temperature = (int32_t) (t * 1000);
+    *humidity = (int32_t) (h * 1000);
+  }
+
+  // index of the newest completed measurement, 0 if none yet
+  uint64_t completed() {
+    switch (sensor.mode) {
+      case Periodic:
+      case LowPowerPeriodic:
+        return (sim->now_ns - sensor.started_ns) / sensor.interval_ns;
+      case SingleShot:
+        return sim->now_ns - sensor.started_ns >= (sensor.rht_only ? SINGLE_SHOT_RHT_NS : SINGLE_SHOT_NS) ? 1 : 0;
+      default:
+        return 0;
+    }
+  }
+
+  bool measuring() {
+    return sensor.mode == Periodic || sensor.mode == LowPowerPeriodic;
+  }
+
+  uint8_t crc8(const uint8_t *data, int count) {
+    uint8_t crc = 0xff;
+    for (int i = 0; i < count; ++i) {
+      crc ^= data[i];
+      for (int bit = 0; bit < 8; ++bit) crc = crc & 0x80 ? (crc << 1) ^ 0x31 : crc << 1;
+    }
+    return crc;
+  }
+
+  void respond(const uint16_t *words, int count) {
+    for (int i = 0; i < count; ++i) {
+      uint8_t *p = sensor.response + i * 3;
+      p[0] = words[i] >> 8;
+      p[1] = words[i];
+      p[2] = crc8(p, 2);
+    }
+    sensor.response_length = count * 3;
+  }
+
+  uint16_t ticks(double value, double offset, double scale) {
+    double t = std::round((value + offset) * 65535 / scale);
+    return t < 0 ? 0 : t > 65535 ? 65535 : (uint16_t) t;
+  }
+
+  // the bus is shared with nothing else, so a transfer just takes its time
+  void transfer(size_t length) {
+    ++sim->i2c_transfers;
+    sim_advance_ns((length + 1) * BYTE_NS);
+  }
+
+  // deterministic, so a run with faults is as repeatable as one without
+  bool fault() {
+    if (!sim->i2c_fault_permille || noise(sim->i2c_transfers * 7919) % 1000 >= sim->i2c_fault_permille) return false;
+    ++sim->i2c_faults;
+    return true;
+  }
+
+  bool busy() {
+    return sim->now_ns < sensor.busy_until_ns;
+  }
+
+  // execution time in us, or -1 to refuse the command
+  int64_t execute(uint16_t code, uint16_t argument) {
+    bool idle = sensor.mode == Idle || sensor.mode == SingleShot;
+    switch (code) {
+      case 0x21b1:  // start_periodic_measurement
+        if (!idle) return -1;
+        set_mode(Periodic);
+        sensor.interval_ns = PERIODIC_INTERVAL_NS;
+        sensor.rht_only = false;
+        return 0;
+      case 0x21ac:  // start_low_power_periodic_measurement
+        if (!idle) return -1;
+        set_mode(LowPowerPeriodic);
+        sensor.interval_ns = LOW_POWER_INTERVAL_NS;
+        sensor.rht_only = false;
+        return 0;
+      case 0x3f86:  // stop_periodic_measurement
+        if (measuring()) set_mode(Idle);
+        return 500000;
+      case 0xe4b8: {  // get_data_ready_status
+        uint16_t status = completed() > sensor.consumed ? 0x8006 : 0x8000;
+        respond(&status, 1);
+        return 1000;
+      }
+      case 0xec05: {  // read_measurement, with nothing new the read gets no acknowledge
+        uint64_t newest = completed();
+        if (newest <= sensor.consumed) return 1000;
+        sensor.consumed = newest;
+
+        uint64_t taken_ns = sensor.mode == SingleShot ? sim->now_ns : sensor.started_ns + newest * sensor.interval_ns;
+        uint16_t co2;
+        int32_t temperature, humidity;
+        sample(taken_ns, &co2, &temperature, &humidity);
+        uint16_t words[3] = {co2, ticks(temperature / 1000.0, 45, 175), ticks(humidity / 1000.0, 0, 100)};
+        respond(words, 3);
+        // a sensor left measuring through deep sleep is only waited on from the wake
+        uint64_t since_ns = sensor.waiting_since_ns > sim->wake_ns ? sensor.waiting_since_ns : sim->wake_ns;
+        sim_phase(SIM_PHASE_SENSOR_WAIT, sim->now_ns - since_ns);
+        sensor.waiting_since_ns = sim->now_ns;
+        sim->reading_ns = sim->now_ns;
+        return 1000;
+      }
+      case 0x362f: {  // perform_forced_recalibration
+        if (sensor.mode != Idle) return -1;
+        uint16_t correction = 0x8000 + argument - (uint16_t) room_co2(sim->now_ns);
+        respond(&correction, 1);
+        return 400000;
+      }
+      case 0x219d:  // measure_single_shot
+        if (!idle) return -1;
+        set_mode(SingleShot, SINGLE_SHOT_NS);
+        sensor.rht_only = false;
+        return SINGLE_SHOT_NS / 1000;
+      case 0x2196:  // measure_single_shot_rht_only
+        if (!idle) return -1;
+        set_mode(SingleShot, SINGLE_SHOT_RHT_NS);
+        sensor.rht_only = true;
+        return SINGLE_SHOT_RHT_NS / 1000;
+      case 0x36e0:  // power_down
+        if (!idle) return -1;
+        set_mode(PowerDown);
+        return 1000;
+      case 0x3646:  // reinit
+        if (!idle) return -1;
+        set_mode(Idle);
+        return 20000;
+      default:
+        return -1;
+    }
+  }
+}
+
+double sim_sensor_charge_mas(uint64_t from, uint64_t to) {
+  if (history_len == 0) return mode_ma(Idle) * (to - from) / 1e9;
+
+  double charge = 0;
+  for (uint32_t i = 0; i < history_len; ++i) {
+    uint64_t start = history[i].at_ns;
+    uint64_t end = i + 1 < history_len ? history[i + 1].at_ns : UINT64_MAX;
+    if (end <= from || start >= to) continue;
+    uint64_t a = start > from ? start : from;
+    uint64_t b = end < to ? end : to;
+    charge += mode_ma(history[i].mode) * (b - a) / 1e9;
+
+    // a single shot draws periodic-mode current while it measures
+    uint64_t busy_end = history[i].busy_until_ns < b ? history[i].busy_until_ns : b;
+    if (busy_end > a) charge += (mode_ma(Periodic) - mode_ma(history[i].mode)) * (busy_end - a) / 1e9;
+  }
+  return charge;
+}
+
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop, uint timeout_us) {
+  transfer(len);
+  if (addr != ADDRESS || len < 2) return PICO_ERROR_GENERIC;
+
+  // wake_up is never acknowledged, asleep or not
+  uint16_t code = src[0] << 8 | src[1];
+  if (code == 0x36f6) {
+    if (sensor.mode == PowerDown) set_mode(Idle);
+    sensor.busy_until_ns = sim->now_ns + 20000ull * 1000;
+    return PICO_ERROR_GENERIC;
+  }
+  if (sensor.mode == PowerDown || busy() || fault()) return PICO_ERROR_GENERIC;
+
+  uint16_t argument = 0;
+  if (len == 5) {
+    if (crc8(src + 2, 2) != src[4]) return PICO_ERROR_GENERIC;
+    argument = src[2] << 8 | src[3];
+  } else if (len != 2) {
+    return PICO_ERROR_GENERIC;
+  }
+
+  sensor.response_length = 0;
+  int64_t execution_us = execute(code, argument);
+  if (execution_us < 0) return PICO_ERROR_GENERIC;
+  sensor.busy_until_ns = sim->now_ns + execution_us * 1000;
+  return len;
+}
+
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us) {
+  transfer(len);
+  if (addr != ADDRESS || busy() || len > sensor.response_length) return PICO_ERROR_GENERIC;
+
+  memcpy(dst, sensor.response, len);
+  sensor.response_length = 0;
+  // a glitch on the bus shows up as a flipped bit
+  if (fault()) dst[sim->i2c_transfers % len] ^= 1 << (sim->i2c_transfers % 8);
+  return len;
+}
@@ -0,0 +1,229 @@
+// Host round trip for the series codec. Each run feeds SeriesEncoder a run of
+// samples, seals a block whenever append() says it is full, and reads every
+// block back through SeriesDecoder, which has to give back exactly what went
+// in. The runs cover timestamps that drift about an even interval, that jump
+// at random and that wrap past 2^32, and deltas sitting either side of each
+// TIME_WIDTHS and VALUE_WIDTHS step. A full block has to turn the sample away
+// without touching what it holds, and only once there is no longer room for
+// the widest sample.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "series.hpp"
+
+namespace {
+  // a 32 bit time and three 17 bit values, each behind a 4 bit prefix
+  const uint32_t WIDEST_SAMPLE_BITS = (4 + 32) + 3 * (4 + 17);
+
+  // the step boundaries, as in series.cpp
+  const uint8_t TIME_WIDTHS[] = {7, 9, 12};
+  const uint8_t VALUE_WIDTHS[] = {4, 8, 12};
+
+  struct Sample {
+    uint32_t time;
+    Reading reading;
+  };
+
+  struct Random {
+    uint32_t state;
+    uint32_t next() {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state;
+    }
+    int32_t between(int32_t low, int32_t high) {
+      return low + (int32_t) (next() % (uint32_t) (high - low + 1));
+    }
+  };
+
+  int32_t unzigzag(uint32_t value) {
+    return (int32_t) (value >> 1) ^ -(int32_t) (value & 1);
+  }
+
+  Reading reading(int32_t co2, int32_t temperature, int32_t humidity) {
+    Reading r;
+    r.co2 = co2;
+    r.temperature = temperature;
+    r.humidity = humidity;
+    return r;
+  }
+
+  bool same(const Reading &a, const Reading &b) {
+    return a.co2 == b.co2 && a.temperature == b.temperature && a.humidity == b.humidity;
+  }
+
+  // around five minutes apart, readings wandering a little each time
+  std::vector<Sample> drifting(uint32_t count, uint32_t seed) {
+    Random random = {seed};
+    std::vector<Sample> samples;
+    uint32_t time = 1792262033;
+    int32_t co2 = 600, temperature = 2150, humidity = 4500;
+    for (uint32_t i = 0; i < count; ++i) {
+      time += 300 + random.between(-2, 2);
+      co2 = std::min(std::max(co2 + random.between(-20, 20), 400), 5000);
+      temperature = std::min(std::max(temperature + random.between(-15, 15), -1000), 6000);
+      humidity = std::min(std::max(humidity + random.between(-40, 40), 0), 10000);
+      samples.push_back({time, reading(co2, temperature, humidity)});
+    }
+    return samples;
+  }
+
+  // any time after any other, any reading after any other
+  std::vector<Sample> random_samples(uint32_t count, uint32_t seed) {
+    Random random = {seed};
+    std::vector<Sample> samples;
+    for (uint32_t i = 0; i < count; ++i) {
+      samples.push_back({random.next(), reading(random.next() & 0xffff, (int16_t) random.next(), random.next() & 0xffff)});
+    }
+    return samples;
+  }
+
+  // counting up through 2^32 and round again
+  std::vector<Sample> wrapping(uint32_t count, uint32_t seed) {
+    Random random = {seed};
+    std::vector<Sample> samples;
+    uint32_t time = 0xffffffffu - 20 * 300;
+    for (uint32_t i = 0; i < count; ++i) {
+      time += 300 + random.between(-200, 4000) * (random.next() % 8 == 0);
+      samples.push_back({time, reading(800, -250, 6000)});
+    }
+    return samples;
+  }
+
+  // the zig-zag codes either side of each step, and the widest there are
+  std::vector<uint32_t> boundary_codes(const uint8_t *widths, uint32_t widest) {
+    std::vector<uint32_t> codes = {1, 2, widest - 1, widest};
+    for (int i = 0; i < 3; ++i) {
+      uint32_t step = 1u << widths[i];
+      for (uint32_t code : {step - 2, step - 1, step, step + 1}) codes.push_back(code);
+    }
+    return codes;
+  }
+
+  // One sample per code, in turn for the timestamp and each value; the value
+  // is set up a sample ahead so it can move by the whole delta.
+  std::vector<Sample> boundaries() {
+    std::vector<Sample> samples;
+    uint32_t time = 1792262033, delta = 300;
+    Reading r = reading(1000, 0, 5000);
+    auto add = [&](uint32_t delta_change) {
+      delta += (uint32_t) unzigzag(delta_change);
+      time += delta;
+      samples.push_back({time, r});
+    };
+
+    for (uint32_t code : boundary_codes(TIME_WIDTHS, 0xffffffffu)) {
+      add(code);
+      // and back to a small interval, so the next code starts from there
+      delta = 300;
+      samples.push_back({time += delta, r});
+      samples.push_back({time += delta, r});
+    }
+
+    // a 16 bit value moves by at most 65535, zig-zag 131070
+    for (uint32_t code : boundary_codes(VALUE_WIDTHS, 131070)) {
+      int32_t change = unzigzag(code);
+      for (int metric = 0; metric < 3; ++metric) {
+        int32_t low = metric == 1 ? -32768 : 0;
+        int32_t from = change < 0 ? low + 65535 : low;
+        Reading set = r, moved = r;
+        if (metric == 0) set.co2 = from, moved.co2 = from + change;
+        if (metric == 1) set.temperature = from, moved.temperature = from + change;
+        if (metric == 2) set.humidity = from, moved.humidity = from + change;
+        samples.push_back({time += delta, set});
+        samples.push_back({time += delta, moved});
+      }
+    }
+    return samples;
+  }
+
+  struct Result {
+    uint32_t blocks;
+    uint32_t bytes;
+    uint32_t errors;
+  };
+
+  bool decodes_to(const uint8_t *block, uint16_t length, const Sample *samples, uint32_t count) {
+    SeriesDecoder decoder;
+    if (!decoder.start(block, length)) return false;
+    uint32_t time;
+    Reading r;
+    for (uint32_t i = 0; i < count; ++i) {
+      if (!decoder.next(&time, &r) || time != samples[i].time || !same(r, samples[i].reading)) return false;
+    }
+    return !decoder.next(&time, &r);
+  }
+
+  Result run(const std::vector<Sample> &samples) {
+    Result result = {};
+    SeriesEncoder encoder;
+    encoder.clear();
+    uint32_t first = 0;
+
+    auto seal = [&](uint32_t end) {
+      std::vector<uint8_t> sealed(encoder.data(), encoder.data() + encoder.size());
+      if (!decodes_to(sealed.data(), sealed.size(), &samples[first], end - first)) ++result.errors;
+      // a length that doesn't match the header is turned away
+      SeriesDecoder decoder;
+      if (decoder.start(sealed.data(), sealed.size() - 1) || decoder.start(sealed.data(), sealed.size() + 1)) {
+        ++result.errors;
+      }
+      ++result.blocks;
+      result.bytes += sealed.size();
+      encoder.clear();
+      first = end;
+    };
+
+    for (uint32_t i = 0; i < samples.size(); ++i) {
+      uint8_t before[SERIES_BLOCK_BYTES];
+      memcpy(before, encoder.data(), sizeof(before));
+      if (!encoder.append(samples[i].time, samples[i].reading)) {
+        // full only when the widest sample might not fit, and left as it was
+        uint32_t free_bits = (SERIES_BLOCK_BYTES - (uint32_t) encoder.size()) * 8;
+        if (free_bits >= WIDEST_SAMPLE_BITS || memcmp(before, encoder.data(), sizeof(before))) {
+          ++result.errors;
+        }
+        seal(i);
+        // an empty block takes anything
+        if (!encoder.append(samples[i].time, samples[i].reading)) ++result.errors;
+      }
+      if (encoder.size() > SERIES_BLOCK_BYTES || encoder.count() != i + 1 - first ||
+          encoder.first_time() != samples[first].time) {
+        ++result.errors;
+      }
+      // the block in RAM reads back as it fills
+      if (!decodes_to(encoder.data(), encoder.size(), &samples[first], i + 1 - first)) ++result.errors;
+    }
+    if (encoder.count()) seal(samples.size());
+    return result;
+  }
+
+  bool report(const char *name, const std::vector<Sample> &samples) {
+    Result result = run(samples);
+    bool ok = !result.errors;
+    printf("%-12s %8zu %7u %9.2f %7u  %s\n", name, samples.size(), result.blocks,
+           (double) result.bytes / samples.size(), result.errors, ok ? "ok" : "FAILED");
+    return ok;
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 100000;
+  if (!count) {
+    fprintf(stderr, "usage: %s [samples per run]\n", argv[0]);
+    return 1;
+  }
+
+  printf("%-12s %8s %7s %9s %7s\n", "run", "samples", "blocks", "B/sample", "errors");
+  bool ok = true;
+  ok &= report("drifting", drifting(count, 0x9e3779b9u));
+  ok &= report("random", random_samples(count, 0x85ebca6bu));
+  ok &= report("wrapping", wrapping(count, 0xc2b2ae35u));
+  ok &= report("boundaries", boundaries());
+  return ok ? 0 : 1;
+}
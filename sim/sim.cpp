@@ -0,0 +1,226 @@
+// Host-native simulator for the badge. Each power-up runs the firmware's main()
+// in a forked child so RAM starts fresh, while flash, the virtual clock and the
+// statistics live in shared memory and carry over like they would on the board.
+// A child lives on through deep sleeps and only exits when the board powers off.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "badger2040.hpp"
+#include "sim.hpp"
+
+int badger_main();
+
+SimShared *sim = nullptr;
+
+void sim_phase(SimPhase phase, uint64_t ns) {
+  SimPhaseStats &stats = sim->phases[phase];
+  ++stats.count;
+  stats.total_ns += ns;
+  if (ns > stats.max_ns) stats.max_ns = ns;
+}
+
+void sim_halt() {
+  sim_phase(SIM_PHASE_AWAKE, sim->now_ns - sim->wake_ns);
+  fflush(stdout);
+  _exit(0);
+}
+
+bool sim_start_wake(uint32_t buttons) {
+  if (sim->wake_count == sim->wake_limit) return false;
+  sim->wake_index = sim->wake_count++;
+  sim->wake_ns = sim->now_ns;
+  sim->wake_buttons = buttons;
+  sim->painted = false;
+  sim->reading_ns = 0;
+  sim->press_ns = 0;
+  if (buttons) ++sim->button_wakes;
+  return true;
+}
+
+uint64_t sim_next_press_ns() {
+  return sim->press_index * sim->press_interval_ns;
+}
+
+namespace {
+  const char *phase_names[SIM_PHASE_COUNT] = {
+    "awake",
+    "wake to paint",
+    "sensor wait",
+    "reading to refresh",
+    "press to refresh",
+    "render",
+    "update",
+    "partial update",
+    "flash erase",
+    "flash program",
+    "deep sleep",
+  };
+
+  void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [-n wakes] [-i interval_s] [-b buttons] [-m max_awake_s] [-c battery_mah] [-s percent] [-u] [-e faults] [-f flash.bin] [-o pbm_dir] [-v]\n"
+            "  -n  number of wakes to simulate, by button or by alarm (default 10)\n"
+            "  -i  seconds from one button press to the next (default 300)\n"
+            "  -b  buttons pressed, cycled, from A B C U D (default B)\n"
+            "  -m  give up on a wake after this many seconds awake (default 600)\n"
+            "  -c  battery capacity, for the simulated pack and the runtime estimate (default 1000)\n"
+            "  -s  charge the pack starts with, in percent (default 100)\n"
+            "  -u  power the board from USB, so the pack isn't drawn on\n"
+            "  -e  I2C transfers in a thousand that fail, for the sensor's retries (default 0)\n"
+            "  -f  load the flash image from and save it to this file\n"
+            "  -o  write every refreshed frame as a PBM into this directory\n"
+            "  -v  show the firmware's stdout\n",
+            name);
+    exit(1);
+  }
+
+  uint32_t button_mask(char c) {
+    switch (c) {
+      case 'A': case 'a': return 1u << pimoroni::Badger2040::A;
+      case 'B': case 'b': return 1u << pimoroni::Badger2040::B;
+      case 'C': case 'c': return 1u << pimoroni::Badger2040::C;
+      case 'U': case 'u': return 1u << pimoroni::Badger2040::UP;
+      case 'D': case 'd': return 1u << pimoroni::Badger2040::DOWN;
+      default: return 0;
+    }
+  }
+}
+
+uint32_t sim_take_press() {
+  return button_mask(sim->buttons[sim->press_index++ % strlen(sim->buttons)]);
+}
+
+namespace {
+  void report(double battery_mah) {
+    printf("%-18s %8s %12s %12s %12s\n", "phase", "count", "total ms", "mean ms", "max ms");
+    for (int i = 0; i < SIM_PHASE_COUNT; ++i) {
+      const SimPhaseStats &stats = sim->phases[i];
+      double mean = stats.count ? stats.total_ns / 1e6 / stats.count : 0;
+      printf("%-18s %8u %12.1f %12.2f %12.2f\n", phase_names[i], stats.count, stats.total_ns / 1e6, mean,
+             stats.max_ns / 1e6);
+    }
+
+    uint32_t erases = 0, worst = 0;
+    for (uint32_t i = 0; i < SIM_SECTOR_COUNT; ++i) {
+      erases += sim->sector_erases[i];
+      if (sim->sector_erases[i] > worst) worst = sim->sector_erases[i];
+    }
+    printf("\nrefreshes: %u full, %u partial\n", sim->update_count, sim->partial_update_count);
+    printf("flash: %u sector erases (worst sector %u), %u programs\n", erases, worst, sim->flash_programs);
+    printf("i2c: %u transfers, %u faults injected\n", sim->i2c_transfers, sim->i2c_faults);
+    if (sim->timeouts) printf("wakes that never went back to sleep: %u\n", sim->timeouts);
+
+    // up to the press that would come next
+    double elapsed_s = (sim->now_ns > sim_next_press_ns() ? sim->now_ns : sim_next_press_ns()) / 1e9;
+    double uah_per_wake = sim->charge_mas / 3.6 / sim->wake_count;
+    double avg_ma = sim->charge_mas / elapsed_s;
+    printf("wakes: %u, %u by button, over %.1f hours\n", sim->wake_count, sim->button_wakes, elapsed_s / 3600);
+    printf("charge: %.1f uAh per wake, %.3f mA average, ~%.1f days on %.0f mAh\n", uah_per_wake, avg_ma,
+           battery_mah / avg_ma / 24, battery_mah);
+    if (sim->usb) {
+      printf("battery: on USB\n");
+    } else {
+      printf("battery: %.1f%% left, %.2f V\n", sim_battery_percent(), sim_battery_mv() / 1000);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t wakes = 10;
+  double interval_s = 300;
+  double max_awake_s = 600;
+  double battery_mah = 1000;
+  double start_percent = 100;
+  bool usb = false;
+  uint32_t fault_permille = 0;
+  std::string buttons = "B";
+  const char *flash_path = nullptr;
+  const char *pbm_dir = "";
+  bool verbose = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "n:i:b:m:c:s:ue:f:o:v")) != -1) {
+    switch (opt) {
+      case 'n': wakes = strtoul(optarg, nullptr, 10); break;
+      case 'i': interval_s = strtod(optarg, nullptr); break;
+      case 'b': buttons = optarg; break;
+      case 'm': max_awake_s = strtod(optarg, nullptr); break;
+      case 'c': battery_mah = strtod(optarg, nullptr); break;
+      case 's': start_percent = strtod(optarg, nullptr); break;
+      case 'u': usb = true; break;
+      case 'e': fault_permille = strtoul(optarg, nullptr, 10); break;
+      case 'f': flash_path = optarg; break;
+      case 'o': pbm_dir = optarg; break;
+      case 'v': verbose = true; break;
+      default: usage(argv[0]);
+    }
+  }
+  if (wakes == 0 || buttons.empty() || interval_s <= 0 || battery_mah <= 0) usage(argv[0]);
+
+  sim = (SimShared *) mmap(nullptr, sizeof(SimShared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (sim == MAP_FAILED) {
+    perror("mmap");
+    return 1;
+  }
+  memset(sim->flash, 0xff, sizeof(sim->flash));
+  sim->max_awake_ns = (uint64_t) (max_awake_s * 1e9);
+  sim->wake_limit = wakes;
+  sim->i2c_fault_permille = fault_permille;
+  sim->battery_mah = battery_mah;
+  sim->battery_start_percent = start_percent;
+  sim->usb = usb;
+  sim->press_interval_ns = (uint64_t) (interval_s * 1e9);
+  snprintf(sim->buttons, sizeof(sim->buttons), "%s", buttons.c_str());
+  snprintf(sim->pbm_dir, sizeof(sim->pbm_dir), "%s", pbm_dir);
+
+  if (flash_path) {
+    if (FILE *f = fopen(flash_path, "rb")) {
+      fread(sim->flash, 1, sizeof(sim->flash), f);
+      fclose(f);
+    }
+  }
+
+  while (sim->wake_count < wakes) {
+    // powered off, so only a button press brings the board up
+    if (sim->now_ns < sim_next_press_ns()) sim->now_ns = sim_next_press_ns();
+    sim->boot_ns = sim->now_ns;
+    sim->timer_paused_ns = 0;
+    sim_start_wake(sim_take_press());
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return 1;
+    }
+    if (pid == 0) {
+      if (!verbose) freopen("/dev/null", "w", stdout);
+      badger_main();
+      sim_halt();
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      fprintf(stderr, "wake %u: firmware crashed (status 0x%x)\n", sim->wake_index, status);
+      return 1;
+    }
+  }
+
+  if (flash_path) {
+    if (FILE *f = fopen(flash_path, "wb")) {
+      fwrite(sim->flash, 1, sizeof(sim->flash), f);
+      fclose(f);
+    }
+  }
+
+  printf("%u wakes, button presses %.0f s apart, buttons \"%s\"\n\n", wakes, interval_s, buttons.c_str());
+  report(battery_mah);
+  return 0;
+}
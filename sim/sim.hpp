@@ -0,0 +1,114 @@
+#pragma once
+// shared plumbing between the simulator harness and its hardware stand-ins
+
+#include <cstdint>
+
+#include "pico/platform.h"
+
+enum SimPhase : uint8_t {
+  SIM_PHASE_AWAKE,
+  SIM_PHASE_WAKE_TO_PAINT,
+  SIM_PHASE_SENSOR_WAIT,
+  SIM_PHASE_READING_TO_REFRESH,
+  SIM_PHASE_PRESS_TO_REFRESH,
+  SIM_PHASE_RENDER,
+  SIM_PHASE_UPDATE,
+  SIM_PHASE_PARTIAL_UPDATE,
+  SIM_PHASE_FLASH_ERASE,
+  SIM_PHASE_FLASH_PROGRAM,
+  SIM_PHASE_DEEP_SLEEP,
+  SIM_PHASE_COUNT
+};
+
+struct SimPhaseStats {
+  uint32_t count;
+  uint64_t total_ns;
+  uint64_t max_ns;
+};
+
+#define SIM_SECTOR_COUNT (PICO_FLASH_SIZE_BYTES / 4096)
+
+// lives in a MAP_SHARED mapping so it survives the child process that runs
+// the firmware from each power-up until it powers off
+struct SimShared {
+  uint64_t now_ns;
+  uint64_t boot_ns;
+  // the system timer stops while the chip is in deep sleep
+  uint64_t timer_paused_ns;
+  uint64_t wake_ns;
+  uint64_t max_awake_ns;
+  uint32_t wake_index;
+  uint32_t wake_count;
+  uint32_t wake_limit;
+  uint32_t wake_buttons;
+  uint32_t button_wakes;
+  uint32_t timeouts;
+  bool painted;
+  // when the sensor last gave a reading that no refresh has shown yet
+  uint64_t reading_ns;
+  // the first button press while awake that no refresh has shown yet
+  uint64_t press_ns;
+
+  // button presses come every press_interval_ns, cycling through buttons
+  uint64_t press_interval_ns;
+  uint32_t press_index;
+  char buttons[64];
+
+  double charge_mas;
+  // the pack, which charge_mas drains unless the board is on USB
+  double battery_mah;
+  double battery_start_percent;
+  bool usb;
+  SimPhaseStats phases[SIM_PHASE_COUNT];
+  uint32_t update_count;
+  uint32_t partial_update_count;
+  uint32_t sector_erases[SIM_SECTOR_COUNT];
+  uint32_t flash_programs;
+  uint32_t i2c_transfers;
+  uint32_t i2c_faults;
+  uint32_t i2c_fault_permille;
+
+  char pbm_dir[256];
+
+  uint8_t flash[PICO_FLASH_SIZE_BYTES];
+};
+
+extern SimShared *sim;
+
+// burn virtual time, taking whatever interrupts come due meanwhile
+void sim_advance_ns(uint64_t ns);
+void sim_phase(SimPhase phase, uint64_t ns);
+
+// end of a wake: the board powers off until the harness starts the next one
+[[noreturn]] void sim_halt();
+
+// starts the next wake, false once the run has had all of them
+bool sim_start_wake(uint32_t buttons);
+
+// the next scheduled button press
+uint64_t sim_next_press_ns();
+uint32_t sim_take_press();
+
+// the next edge on a gpio with its interrupt enabled, a button press or the
+// panel going idle, and delivering it to the gpio callback
+bool sim_next_gpio_irq(uint64_t *at_ns);
+void sim_gpio_irq();
+
+// when the panel's busy pin releases
+uint64_t sim_panel_idle_ns();
+
+// core0 waits for an interrupt; in deep sleep the chip draws sleep current
+// and the system timer stops
+void sim_sleep_until(uint64_t ns, bool deep);
+
+// what's left of the pack, and its voltage from the discharge curve
+double sim_battery_percent();
+double sim_battery_mv();
+
+// charge in mA*s drawn by each part over [from, to)
+double sim_panel_charge_mas(uint64_t from, uint64_t to);
+double sim_sensor_charge_mas(uint64_t from, uint64_t to);
+
+#define SIM_MCU_AWAKE_MA 25.0
+// RP2040 sleep with only the RTC clocked, plus the board's regulator
+#define SIM_MCU_SLEEP_MA 1.0
@@ -0,0 +1,208 @@
+// RTC, GPIO interrupt and sleep stand-ins. The RTC counts whole seconds of
+// virtual time from whenever it was last set; __wfi skips the virtual clock
+// ahead to the alarm or the next edge on a gpio with its interrupt enabled,
+// whichever is first. Awake, cores.cpp delivers the edges as they come due.
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+
+#include "hardware/clocks.h"
+#include "hardware/gpio.h"
+#include "hardware/rtc.h"
+#include "hardware/structs/scb.h"
+#include "hardware/sync.h"
+#include "badger2040.hpp"
+#include "sim.hpp"
+
+#define NS_PER_S (1000ull * 1000 * 1000)
+
+clocks_hw_t sim_clocks_hw = {~0u, ~0u};
+armv6m_scb_hw_t sim_scb_hw = {0};
+
+namespace {
+  struct Rtc {
+    bool running = false;
+    time_t set_s = 0;
+    uint64_t set_ns = 0;
+    bool alarm = false;
+    time_t alarm_s = 0;
+    rtc_callback_t callback = nullptr;
+  } rtc;
+
+  uint32_t irq_gpios = 0;
+  gpio_irq_callback_t irq_callback = nullptr;
+
+  time_t rtc_now_s() {
+    return rtc.set_s + (time_t) ((sim->now_ns - rtc.set_ns) / NS_PER_S);
+  }
+
+  uint64_t rtc_ns(time_t s) {
+    return rtc.set_ns + (uint64_t) (s - rtc.set_s) * NS_PER_S;
+  }
+
+  time_t to_seconds(const datetime_t *t) {
+    struct tm tm = {};
+    tm.tm_year = t->year - 1900;
+    tm.tm_mon = t->month - 1;
+    tm.tm_mday = t->day;
+    tm.tm_hour = t->hour;
+    tm.tm_min = t->min;
+    tm.tm_sec = t->sec;
+    return timegm(&tm);
+  }
+
+  // the next press on a button that can interrupt, skipping the ones nobody hears
+  bool next_button_press(uint64_t *at_ns) {
+    for (size_t i = strlen(sim->buttons); irq_gpios && i; --i) {
+      uint32_t index = sim->press_index;
+      if (sim_take_press() & irq_gpios) {
+        sim->press_index = index;
+        *at_ns = sim_next_press_ns();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const uint BUSY = pimoroni::Badger2040::BUSY;
+  // the end of the refresh whose edge has been delivered
+  uint64_t busy_edge_ns = 0;
+
+  // busy is active low, so the panel going idle is a rising edge
+  bool next_busy_edge(uint64_t *at_ns) {
+    uint64_t idle_ns = sim_panel_idle_ns();
+    if (!(irq_gpios & (1u << BUSY)) || idle_ns < sim->now_ns || idle_ns == busy_edge_ns) return false;
+    *at_ns = idle_ns;
+    return true;
+  }
+
+  // false if neither comes, otherwise busy says which comes first
+  bool next_edge(uint64_t *at_ns, bool *busy) {
+    uint64_t press_ns = 0, busy_ns = 0;
+    bool press = next_button_press(&press_ns);
+    *busy = next_busy_edge(&busy_ns);
+    if (!press && !*busy) return false;
+    if (press && (!*busy || press_ns <= busy_ns)) *busy = false;
+    *at_ns = *busy ? busy_ns : press_ns;
+    return true;
+  }
+}
+
+bool sim_next_gpio_irq(uint64_t *at_ns) {
+  bool busy;
+  return next_edge(at_ns, &busy);
+}
+
+void sim_gpio_irq() {
+  uint64_t at_ns;
+  bool busy;
+  if (!next_edge(&at_ns, &busy) || at_ns > sim->now_ns) return;
+  uint32_t gpios;
+  if (busy) {
+    busy_edge_ns = at_ns;
+    gpios = 1u << BUSY;
+  } else {
+    gpios = sim_take_press() & irq_gpios;
+    if (!sim->press_ns) sim->press_ns = sim->now_ns;
+  }
+  for (uint gpio = 0; gpio < 32; ++gpio) {
+    if (gpios & (1u << gpio) && irq_callback) irq_callback(gpio, GPIO_IRQ_EDGE_RISE);
+  }
+}
+
+void rtc_init() {
+  rtc = Rtc();
+}
+
+bool rtc_set_datetime(datetime_t *t) {
+  rtc.running = true;
+  rtc.set_s = to_seconds(t);
+  rtc.set_ns = sim->now_ns;
+  return true;
+}
+
+bool rtc_get_datetime(datetime_t *t) {
+  if (!rtc.running) return false;
+  time_t now = rtc_now_s();
+  struct tm tm;
+  gmtime_r(&now, &tm);
+  t->year = tm.tm_year + 1900;
+  t->month = tm.tm_mon + 1;
+  t->day = tm.tm_mday;
+  t->dotw = tm.tm_wday;
+  t->hour = tm.tm_hour;
+  t->min = tm.tm_min;
+  t->sec = tm.tm_sec;
+  return true;
+}
+
+bool rtc_running() {
+  return rtc.running;
+}
+
+// only full dates; the hardware also matches on wildcards, which we don't use
+void rtc_set_alarm(datetime_t *t, rtc_callback_t user_callback) {
+  rtc.alarm = true;
+  rtc.alarm_s = to_seconds(t);
+  rtc.callback = user_callback;
+}
+
+void rtc_disable_alarm() {
+  rtc.alarm = false;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback) {
+  irq_callback = callback;
+  gpio_set_irq_enabled(gpio, event_mask, enabled);
+}
+
+// buttons and busy only ever rise, so any enabled edge hears them
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) {
+  if (enabled && event_mask) {
+    irq_gpios |= 1u << gpio;
+  } else {
+    irq_gpios &= ~(1u << gpio);
+  }
+}
+
+void __wfi() {
+  uint64_t edge_ns = 0;
+  bool edge = sim_next_gpio_irq(&edge_ns);
+  bool alarm = rtc.alarm && rtc.running;
+  if (!edge && !alarm) {
+    // nothing can ever wake us, which is as good as powered off
+    sim_halt();
+  }
+
+  uint64_t alarm_ns = alarm ? rtc_ns(rtc.alarm_s) : 0;
+  bool by_alarm = alarm && (!edge || alarm_ns <= edge_ns);
+  uint64_t wake_ns = by_alarm ? alarm_ns : edge_ns;
+  bool deep = sim_scb_hw.scr & M0PLUS_SCR_SLEEPDEEP_BITS;
+
+  if (deep) {
+    sim_phase(SIM_PHASE_AWAKE, sim->now_ns - sim->wake_ns);
+    if (sim->wake_count == sim->wake_limit) {
+      fflush(stdout);
+      _exit(0);
+    }
+  }
+  uint64_t asleep_ns = sim->now_ns;
+  sim_sleep_until(wake_ns, deep);
+  if (deep) {
+    sim_phase(SIM_PHASE_DEEP_SLEEP, sim->now_ns - asleep_ns);
+    uint32_t index = sim->press_index;
+    sim_start_wake(by_alarm ? 0 : sim_take_press() & irq_gpios);
+    sim->press_index = index;
+  }
+
+  if (by_alarm) {
+    rtc.alarm = false;
+    if (rtc.callback) rtc.callback();
+  } else {
+    sim_gpio_irq();
+  }
+  // the press that woke us counts towards wake to paint instead
+  if (deep) sim->press_ns = 0;
+}
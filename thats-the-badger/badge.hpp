@@ -1,298 +0,0 @@
-const uint8_t badge_bitmap[] = {
-      0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-      0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-      0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x79, 0xc0, 0x00, 0x00, 0x1c, 0xf0,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-      0xf0, 0x00, 0x00, 0x7c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x01, 0x00, 0x00, 0x00, 0x79, 0xf3, 0x00, 0x06, 0x7c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-      0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x70, 0x73, 0xc0, 0x1e, 0x70, 0x70, 0x00,
-      0x00, 0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x03,
-      0xe0, 0x3e, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0xe5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x30, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x1c, 0x03, 0x3e, 0x00, 0x7c, 0x06, 0x7c, 0x1f, 0x00, 0x07, 0x00, 0x03, 0xe0,
-      0x0f, 0xcc, 0x07, 0xcc, 0x07, 0xc0, 0xff, 0x7f, 0x80, 0x01, 0x80, 0x00, 0x00, 0x70, 0x00, 0x0f,
-      0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0xff, 0x01, 0xff, 0x07, 0xff, 0x7f,
-      0x80, 0x07, 0x00, 0x0f, 0xf0, 0x1f, 0xfc, 0x1f, 0xfc, 0x0f, 0xf0, 0xff, 0x7f, 0x80, 0x00, 0x80,
-      0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0xc3,
-      0x83, 0x83, 0x87, 0x87, 0xe3, 0xc0, 0x07, 0x00, 0x1c, 0x38, 0x38, 0x7c, 0x3c, 0x3c, 0x1c, 0x38,
-      0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x1c, 0x03, 0x81, 0xc3, 0x01, 0x87, 0x03, 0xc0, 0xc0, 0x07, 0x00, 0x18, 0x1c, 0x70,
-      0x1c, 0x30, 0x1c, 0x38, 0x18, 0x30, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-      0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x01, 0xc7, 0x01, 0xc7, 0x03, 0x80, 0xc0,
-      0x07, 0x00, 0x30, 0x0c, 0x60, 0x1c, 0x70, 0x0c, 0x30, 0x0c, 0x30, 0x1c, 0x00, 0x01, 0x80, 0x00,
-      0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x01, 0xc6,
-      0x00, 0xc7, 0x01, 0x80, 0xc0, 0x07, 0x00, 0x38, 0x0c, 0x60, 0x1c, 0x60, 0x0c, 0x30, 0x1c, 0x30,
-      0x1c, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x1c, 0x03, 0x00, 0xc6, 0x00, 0xc7, 0x01, 0x80, 0xc0, 0x07, 0x00, 0x3f, 0xfc, 0x60, 0x0c,
-      0x60, 0x0c, 0x3f, 0xfc, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0xc6, 0x00, 0xc7, 0x01, 0x80, 0xc0, 0x07,
-      0x00, 0x30, 0x00, 0x60, 0x1c, 0x70, 0x0c, 0x30, 0x00, 0x30, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0xc7, 0x01,
-      0xc7, 0x01, 0x80, 0xc0, 0x07, 0x00, 0x38, 0x00, 0x70, 0x1c, 0x30, 0x1c, 0x30, 0x00, 0x30, 0x1c,
-      0x00, 0x01, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x1c, 0x03, 0x00, 0xc3, 0x01, 0x87, 0x01, 0x80, 0xc0, 0x07, 0x00, 0x18, 0x00, 0x38, 0x3c, 0x38,
-      0x3c, 0x38, 0x00, 0x30, 0x1c, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0xc3, 0xc7, 0x87, 0x01, 0x80, 0xc0, 0x07, 0x00,
-      0x1e, 0x18, 0x3f, 0xfc, 0x1f, 0xfc, 0x1c, 0x38, 0x38, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-      0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0xc1, 0xff, 0x07,
-      0x01, 0x80, 0xc0, 0x07, 0xff, 0x8f, 0xf8, 0x0f, 0xdc, 0x0f, 0xcc, 0x0f, 0xf8, 0x3f, 0x0f, 0xc0,
-      0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-      0x03, 0x00, 0xc0, 0x7c, 0x06, 0x01, 0x80, 0xc0, 0x03, 0xff, 0x83, 0xe0, 0x00, 0x1c, 0x00, 0x0c,
-      0x03, 0xe0, 0x0f, 0x07, 0x80, 0x01, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00,
-      0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xf8, 0x3e, 0xf8, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x02, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x1f, 0xe0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07,
-      0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-      0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x03, 0x0e, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
-      0x03, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-      0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x47, 0xf8, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-      0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x46, 0x0e, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x18, 0x00, 0x84, 0x01, 0x80, 0x0c, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0x80, 0x00, 0x00, 0x60, 0x00, 0x07, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x08, 0x00,
-      0x84, 0x00, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xe0,
-      0x00, 0x00, 0x00, 0x08, 0x01, 0x84, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-      0x00, 0x07, 0x00, 0x01, 0xcc, 0x00, 0x00, 0x00, 0x04, 0x01, 0x04, 0x00, 0x40, 0x0c, 0x00, 0x09,
-      0xf8, 0x07, 0xf2, 0x0c, 0x17, 0xf0, 0x0f, 0xe0, 0x3f, 0x81, 0x38, 0xc1, 0x7f, 0x00, 0xfe, 0x40,
-      0x01, 0x00, 0x00, 0x00, 0x79, 0xe0, 0x07, 0x00, 0x0f, 0xdf, 0x80, 0x00, 0x00, 0x04, 0x03, 0x04,
-      0x00, 0x40, 0x0c, 0x00, 0x0a, 0x04, 0x0c, 0x0a, 0x0c, 0x1c, 0x18, 0x18, 0x30, 0x60, 0xc1, 0xc0,
-      0xc1, 0xc1, 0x81, 0x81, 0x40, 0x01, 0x80, 0x00, 0x00, 0x79, 0xf8, 0x00, 0x00, 0x1b, 0x8d, 0xc0,
-      0x00, 0x00, 0x06, 0x02, 0x04, 0x00, 0xc0, 0x0c, 0x00, 0x0c, 0x06, 0x18, 0x06, 0x0c, 0x18, 0x08,
-      0x30, 0x10, 0xc0, 0x61, 0x80, 0xc1, 0x80, 0x83, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x00, 0x01, 0xfb,
-      0x00, 0x06, 0x31, 0x0c, 0x60, 0x00, 0x00, 0x02, 0x06, 0x04, 0x00, 0x80, 0x0f, 0xfc, 0x08, 0x02,
-      0x10, 0x02, 0x0c, 0x10, 0x0c, 0x20, 0x08, 0x80, 0x21, 0x80, 0xc1, 0x00, 0x42, 0x00, 0xc0, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x33, 0xc0, 0x1e, 0x33, 0x06, 0x60, 0x00, 0x00, 0x03, 0x04, 0x04, 0x01,
-      0x80, 0x0c, 0x00, 0x08, 0x02, 0x10, 0x02, 0x0c, 0x10, 0x04, 0x60, 0x08, 0x80, 0x21, 0x80, 0xc1,
-      0x00, 0x42, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3e, 0x36, 0x07, 0x60, 0x00,
-      0x00, 0x01, 0x04, 0x06, 0x0e, 0x00, 0x0c, 0x00, 0x08, 0x02, 0x10, 0x02, 0x0c, 0x10, 0x04, 0x7f,
-      0xf8, 0xff, 0xe1, 0x00, 0xc1, 0x00, 0x46, 0x00, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xe0,
-      0x3c, 0x3e, 0x03, 0xe0, 0x00, 0x00, 0x01, 0x88, 0x07, 0xf8, 0x00, 0x0c, 0x00, 0x08, 0x02, 0x10,
-      0x02, 0x0c, 0x10, 0x04, 0x60, 0x00, 0x80, 0x01, 0x00, 0xc1, 0x00, 0x42, 0x00, 0x40, 0x00, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x4f, 0x90, 0x1c, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00,
-      0x0c, 0x00, 0x08, 0x02, 0x10, 0x02, 0x0c, 0x10, 0x04, 0x20, 0x00, 0x80, 0x01, 0x00, 0xc1, 0x00,
-      0x42, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x98, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x02, 0x18, 0x06, 0x0c, 0x10, 0x04, 0x20, 0x00,
-      0x80, 0x01, 0x00, 0xc1, 0x00, 0x43, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x02, 0x0c, 0x0e,
-      0x0c, 0x10, 0x04, 0x30, 0x00, 0x40, 0x01, 0x00, 0xc1, 0x00, 0x41, 0x81, 0x40, 0x01, 0x80, 0x00,
-      0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x0c,
-      0x00, 0x08, 0x02, 0x07, 0x32, 0x0c, 0x10, 0x04, 0x18, 0x30, 0x20, 0x41, 0x00, 0xc1, 0x00, 0x40,
-      0xee, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x60, 0x04, 0x00, 0x00, 0x0f, 0xff, 0x08, 0x02, 0x00, 0xc2, 0x0c, 0x10, 0x04, 0x07, 0xe0, 0x1f,
-      0x81, 0x00, 0xc1, 0x00, 0x40, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0xc0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00,
-      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x07, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x0f,
-      0x80, 0x1f, 0x00, 0x00, 0x1f, 0xf0, 0x0f, 0xff, 0x80, 0x1f, 0xff, 0xf0, 0x00, 0xf8, 0x03, 0xff,
-      0xff, 0x80, 0x3f, 0xe0, 0x03, 0xff, 0xe0, 0x00, 0x01, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x1f, 0xff,
-      0x00, 0x07, 0xff, 0xe0, 0x0f, 0x80, 0x3f, 0x00, 0x00, 0x7f, 0xfc, 0x0f, 0xff, 0xe0, 0x1f, 0xff,
-      0xf0, 0x01, 0xf8, 0x03, 0xff, 0xff, 0x80, 0xff, 0xf8, 0x03, 0xff, 0xfc, 0x00, 0x01, 0x80, 0x03,
-      0xff, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x0f, 0x80, 0x7e, 0x00, 0x01, 0xff, 0xfe,
-      0x0f, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x01, 0xfc, 0x03, 0xff, 0xff, 0x83, 0xff, 0xfc, 0x03, 0xff,
-      0xfe, 0x00, 0x00, 0x80, 0x03, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xf8, 0x0f, 0x80,
-      0xfc, 0x00, 0x03, 0xff, 0xff, 0x0f, 0xff, 0xfc, 0x1f, 0xff, 0xf0, 0x03, 0xfc, 0x03, 0xff, 0xff,
-      0x87, 0xff, 0xfe, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x1f, 0x81, 0xfe, 0x1f, 0xe0,
-      0x3f, 0xc3, 0xfc, 0x0f, 0x81, 0xf8, 0x00, 0x07, 0xf8, 0x3f, 0x0f, 0x81, 0xfc, 0x1f, 0x80, 0x00,
-      0x03, 0xfe, 0x00, 0x0f, 0xc0, 0x0f, 0xf0, 0xff, 0x03, 0xf0, 0x7f, 0x80, 0x01, 0x00, 0x03, 0xe0,
-      0x0f, 0x83, 0xf8, 0x07, 0xf0, 0x7f, 0x00, 0xfe, 0x0f, 0x83, 0xf0, 0x00, 0x07, 0xe0, 0x0e, 0x0f,
-      0x80, 0x7e, 0x1f, 0x80, 0x00, 0x07, 0xfe, 0x00, 0x07, 0xc0, 0x0f, 0xc0, 0x3f, 0x83, 0xe0, 0x1f,
-      0x80, 0x01, 0x80, 0x03, 0xe0, 0x0f, 0x83, 0xf0, 0x03, 0xf0, 0x7e, 0x00, 0x7e, 0x0f, 0x87, 0xe0,
-      0x00, 0x0f, 0xc0, 0x00, 0x0f, 0x80, 0x3e, 0x1f, 0x80, 0x00, 0x07, 0xdf, 0x00, 0x07, 0xc0, 0x1f,
-      0x80, 0x1f, 0x83, 0xe0, 0x0f, 0x80, 0x00, 0x80, 0x03, 0xe0, 0x0f, 0x83, 0xe0, 0x01, 0xf8, 0xfc,
-      0x00, 0x3f, 0x0f, 0x8f, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x3e, 0x1f, 0x80, 0x00, 0x07,
-      0x9f, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x0f, 0xc3, 0xe0, 0x0f, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x1f,
-      0x87, 0xe0, 0x00, 0xf8, 0xfc, 0x00, 0x3f, 0x0f, 0x9f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80,
-      0x3e, 0x1f, 0x80, 0x00, 0x0f, 0x8f, 0x80, 0x07, 0xc0, 0x3f, 0x00, 0x07, 0xc3, 0xe0, 0x0f, 0xc0,
-      0x01, 0x00, 0x03, 0xff, 0xff, 0x07, 0xc0, 0x00, 0xf8, 0xf8, 0x00, 0x1f, 0x0f, 0xbf, 0x00, 0x00,
-      0x1f, 0x80, 0x00, 0x0f, 0x80, 0x3e, 0x1f, 0xff, 0xe0, 0x0f, 0x8f, 0x80, 0x07, 0xc0, 0x3e, 0x00,
-      0x07, 0xc3, 0xe0, 0x0f, 0xc0, 0x01, 0x80, 0x03, 0xff, 0xfe, 0x07, 0xc0, 0x00, 0xf8, 0xf8, 0x00,
-      0x1f, 0x0f, 0xff, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0x80, 0x7e, 0x1f, 0xff, 0xe0, 0x1f, 0x0f,
-      0xc0, 0x07, 0xc0, 0x3e, 0x00, 0x07, 0xc3, 0xe0, 0x0f, 0x80, 0x00, 0x80, 0x03, 0xff, 0xff, 0x07,
-      0xc0, 0x00, 0xf8, 0xf8, 0x00, 0x1f, 0x0f, 0xff, 0x80, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0x80, 0xfe,
-      0x1f, 0xff, 0xe0, 0x1f, 0x07, 0xc0, 0x07, 0xc0, 0x3e, 0x00, 0x07, 0xc3, 0xe0, 0x1f, 0x80, 0x00,
-      0x00, 0x03, 0xff, 0xff, 0x87, 0xc0, 0x00, 0xf8, 0xf8, 0x00, 0x1f, 0x0f, 0xff, 0x80, 0x00, 0x1f,
-      0x80, 0x00, 0x0f, 0xff, 0xfc, 0x1f, 0xff, 0xe0, 0x3e, 0x07, 0xc0, 0x07, 0xc0, 0x3e, 0x00, 0x07,
-      0xc3, 0xff, 0xff, 0x00, 0x01, 0x00, 0x03, 0xe0, 0x0f, 0xc7, 0xc0, 0x00, 0xf8, 0xf8, 0x00, 0x1f,
-      0x0f, 0xff, 0xc0, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0xff, 0xf8, 0x1f, 0x80, 0x00, 0x3e, 0x07, 0xe0,
-      0x07, 0xc0, 0x3f, 0x00, 0x07, 0xc3, 0xff, 0xff, 0x00, 0x01, 0x80, 0x03, 0xe0, 0x07, 0xc7, 0xe0,
-      0x01, 0xf8, 0xfc, 0x00, 0x3f, 0x0f, 0xe7, 0xe0, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0xff, 0xf0, 0x1f,
-      0x80, 0x00, 0x7f, 0xff, 0xe0, 0x07, 0xc0, 0x3f, 0x00, 0x0f, 0xc3, 0xff, 0xfc, 0x00, 0x00, 0x80,
-      0x03, 0xe0, 0x07, 0xc3, 0xe0, 0x01, 0xf8, 0x7c, 0x00, 0x3e, 0x0f, 0xc3, 0xf0, 0x00, 0x0f, 0xc0,
-      0x00, 0x0f, 0xff, 0xe0, 0x1f, 0x80, 0x00, 0x7f, 0xff, 0xf0, 0x07, 0xc0, 0x1f, 0x00, 0x0f, 0xc3,
-      0xff, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x07, 0xc3, 0xf0, 0x03, 0xf0, 0x7e, 0x00, 0x7e, 0x0f,
-      0xc3, 0xf8, 0x00, 0x0f, 0xe0, 0x0c, 0x0f, 0x83, 0xf0, 0x1f, 0x80, 0x00, 0xff, 0xff, 0xf0, 0x07,
-      0xc0, 0x1f, 0x80, 0x1f, 0x83, 0xf0, 0xfc, 0x00, 0x01, 0x00, 0x03, 0xe0, 0x07, 0xc1, 0xfc, 0x07,
-      0xe0, 0x3f, 0x00, 0xfc, 0x0f, 0x81, 0xf8, 0x00, 0x07, 0xf0, 0x1e, 0x0f, 0x81, 0xf0, 0x1f, 0x80,
-      0x00, 0xff, 0xff, 0xf8, 0x07, 0xc0, 0x0f, 0xe0, 0x3f, 0x83, 0xe0, 0x7e, 0x00, 0x01, 0x80, 0x03,
-      0xf0, 0x3f, 0xc1, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xfc, 0x0f, 0x80, 0xfc, 0x00, 0x03, 0xff, 0xff,
-      0x0f, 0x81, 0xf8, 0x1f, 0xff, 0xf0, 0xf8, 0x00, 0xf8, 0x07, 0xc0, 0x07, 0xff, 0xff, 0x03, 0xe0,
-      0x3e, 0x00, 0x00, 0x80, 0x03, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xf8, 0x0f, 0x80,
-      0x7e, 0x00, 0x01, 0xff, 0xff, 0x0f, 0x80, 0xfc, 0x1f, 0xff, 0xf9, 0xf0, 0x00, 0xfc, 0x07, 0xc0,
-      0x07, 0xff, 0xfe, 0x03, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x3f, 0xff, 0x80,
-      0x0f, 0xff, 0xe0, 0x0f, 0x80, 0x3f, 0x00, 0x00, 0xff, 0xfe, 0x0f, 0x80, 0x7c, 0x1f, 0xff, 0xf9,
-      0xf0, 0x00, 0x7c, 0x07, 0xc0, 0x01, 0xff, 0xfc, 0x03, 0xe0, 0x1f, 0x80, 0x01, 0x00, 0x03, 0xff,
-      0xfe, 0x00, 0x1f, 0xfe, 0x00, 0x03, 0xff, 0xc0, 0x0f, 0x80, 0x1f, 0x80, 0x00, 0x3f, 0xf8, 0x0f,
-      0x80, 0x3e, 0x1f, 0xff, 0xfb, 0xf0, 0x00, 0x7c, 0x07, 0xc0, 0x00, 0xff, 0xf0, 0x03, 0xe0, 0x0f,
-      0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x78, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-      0x01, 0xe0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x78,
-      0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x84, 0x60, 0x00, 0x00,
-      0x00, 0x00, 0x01, 0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x80, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xc4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-      0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x06, 0xf8, 0x37, 0x8f, 0x80,
-      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xc0, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
-      0x87, 0x9c, 0x3d, 0xf9, 0xc0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe0, 0xc7, 0x06, 0x30, 0x70, 0xc0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4,
-      0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66, 0x06, 0x30, 0x60, 0xc0, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x66,
-      0x02, 0x30, 0x60, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0xc0, 0x66, 0x02, 0x30, 0x60, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x18,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc6, 0x06, 0x30, 0x60, 0x40, 0x00, 0x80,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc7, 0x0e,
-      0x30, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xff, 0x87, 0xfc, 0x30, 0x60, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x06, 0x70, 0x30, 0x60, 0x40, 0x01, 0x80, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x33, 0x33, 0x33, 0x33,
-      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33
-};
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "battery.hpp"
+#include "display.hpp"
+#include "hardware/adc.h"
+#include "hardware/gpio.h"
+
+// not in pimoroni's pin list: switches the 1.24 V reference on, and its output
+#define VREF_POWER 27
+#define REF_1V2 28
+#define REF_1V2_MV 1240
+// the battery reaches the ADC through a divide by three
+#define BATTERY_DIVIDER 3
+// the ADC is noisy to a few counts, and a conversion is only 2 us
+#define ADC_CONVERSIONS 16
+// ADC inputs 0 to 3 are gpios 26 to 29
+#define ADC_FIRST_GPIO 26
+
+// Two AAA alkaline cells at the badge's light load, every tenth from full down
+// to flat. The curve slopes all the way, unlike a lithium cell's, so voltage
+// is a fair guide to what's left.
+static const uint16_t discharge_mv[] = {3200, 2900, 2760, 2660, 2560, 2480, 2400, 2320, 2240, 2100, 1800};
+#define DISCHARGE_STEPS (sizeof(discharge_mv) / sizeof(discharge_mv[0]) - 1)
+
+static uint32_t adc_sum(uint gpio) {
+  adc_select_input(gpio - ADC_FIRST_GPIO);
+  uint32_t sum = 0;
+  for (int i = 0; i < ADC_CONVERSIONS; ++i) sum += adc_read();
+  return sum;
+}
+
+void battery_init() {
+  adc_init();
+  adc_gpio_init(badger.BATTERY);
+  adc_gpio_init(REF_1V2);
+  gpio_init(VREF_POWER);
+  gpio_set_dir(VREF_POWER, GPIO_OUT);
+  gpio_put(VREF_POWER, false);
+  gpio_init(badger.VBUS_DETECT);
+  gpio_set_dir(badger.VBUS_DETECT, GPIO_IN);
+}
+
+Supply battery_read() {
+  gpio_put(VREF_POWER, true);
+  uint32_t reference = adc_sum(REF_1V2);
+  uint32_t battery = adc_sum(badger.BATTERY);
+  gpio_put(VREF_POWER, false);
+
+  Supply supply;
+  supply.usb = gpio_get(badger.VBUS_DETECT);
+  supply.battery_mv = reference ? battery * BATTERY_DIVIDER * REF_1V2_MV / reference : 0;
+  return supply;
+}
+
+uint8_t battery_percent(uint16_t mv) {
+  if (mv >= discharge_mv[0]) return 100;
+  for (uint32_t step = 1; step <= DISCHARGE_STEPS; ++step) {
+    if (mv < discharge_mv[step]) continue;
+    uint32_t above = discharge_mv[step - 1], below = discharge_mv[step];
+    uint32_t tenth = (mv - below) * 10 / (above - below);
+    return (DISCHARGE_STEPS - step) * 10 + tenth;
+  }
+  return 0;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// The supply as the board sees it. The battery comes through a divider to the
+// ADC, whose reference is the 3.3 V rail; that sags as the battery runs down,
+// so each reading is taken against the board's 1.24 V reference as well and
+// the rail cancels out.
+
+struct Supply {
+    // on USB the battery, if there is one, isn't being drawn on
+    bool usb;
+    uint16_t battery_mv;
+};
+
+void battery_init();
+Supply battery_read();
+
+// charge left in percent, from the pack's discharge curve
+uint8_t battery_percent(uint16_t mv);
@@ -0,0 +1,86 @@
+#include <cmath>
+
+#include "cadence.hpp"
+#include "history.hpp"
+
+// about a pixel or two on the charts
+#define CO2_STEP 50
+#define TEMPERATURE_STEP 20
+// older samples count for less, down to 1/e after this long, so one noisy
+// sample can't swing the slope but a new trend takes over within minutes
+#define SLOPE_MEMORY_S 600.0f
+
+// Least squares fit of value against time, with every sum decaying as samples
+// age. Times are relative to the newest sample, so the sums stay small.
+struct SlopeFit {
+  float weight = 0;
+  float t = 0;
+  float tt = 0;
+  float v = 0;
+  float tv = 0;
+
+  void add(float age, float value) {
+    // move the origin up to the new sample, then forget some
+    tt += age * (age * weight - 2 * t);
+    t -= age * weight;
+    tv -= age * v;
+    float keep = expf(-age / SLOPE_MEMORY_S);
+    weight *= keep;
+    t *= keep;
+    tt *= keep;
+    v *= keep;
+    tv *= keep;
+
+    weight += 1;
+    v += value;
+  }
+
+  // per second, 0 until there are two samples to go on
+  float slope() const {
+    float spread = weight * tt - t * t;
+    return spread > 1e-3f ? (weight * tv - t * v) / spread : 0;
+  }
+};
+
+static const Metric tracked[] = {CO2, Temperature};
+static const int32_t steps[] = {CO2_STEP, TEMPERATURE_STEP};
+#define TRACKED_COUNT (sizeof(tracked) / sizeof(tracked[0]))
+
+static SlopeFit fits[TRACKED_COUNT];
+static uint32_t last_time = 0;
+// as a power of two times CADENCE_MIN_S, starting at the ceiling
+static uint8_t shift = 2;
+static uint32_t floor_s = CADENCE_MIN_S;
+
+uint32_t cadence_update(uint32_t time, const Reading &reading) {
+  float age = last_time ? (float) (time - last_time) : 0;
+  last_time = time;
+
+  // the soonest either metric is expected to have moved a step
+  float wanted = CADENCE_MAX_S;
+  for (uint32_t i = 0; i < TRACKED_COUNT; ++i) {
+    fits[i].add(age, reading_value(reading, tracked[i]));
+    float rate = fabsf(fits[i].slope());
+    if (rate * wanted > steps[i]) wanted = steps[i] / rate;
+  }
+
+  // straight down to what the trend needs, but only one step back up at a time
+  uint8_t fits_in = 0;
+  while ((uint32_t) CADENCE_MIN_S << (fits_in + 1) <= wanted) ++fits_in;
+  if (fits_in < shift) shift = fits_in;
+  else if (fits_in > shift) ++shift;
+  return cadence_interval();
+}
+
+uint32_t cadence_interval() {
+  uint32_t interval = cadence_wanted();
+  return interval > floor_s ? interval : floor_s;
+}
+
+uint32_t cadence_wanted() {
+  return (uint32_t) CADENCE_MIN_S << shift;
+}
+
+void cadence_set_floor(uint32_t interval_s) {
+  floor_s = interval_s;
+}
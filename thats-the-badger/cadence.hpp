@@ -0,0 +1,27 @@
+#pragma once
+
+#include "state.hpp"
+
+// How long to wait for the next sample. Every sample goes into a running slope
+// estimate for CO2 and temperature, and the interval is cut to about the time
+// the faster of the two takes to move by a step worth showing. While they hold
+// still it doubles instead, up to a ceiling. So a meeting room filling up is
+// sampled every minute or so, and a quiet one every five minutes as before.
+// A longer ceiling would save samples overnight but then catch the start of a
+// meeting late, and the charts would draw the rise as a ramp from nowhere.
+//
+// Intervals are 75 s times a power of two, so wakes stay on a grid that the
+// ten minute and hourly buckets divide evenly whatever the cadence does.
+
+#define CADENCE_MIN_S 75
+#define CADENCE_MAX_S (4 * CADENCE_MIN_S)
+
+// time is in seconds and must not go backwards; returns the new interval
+uint32_t cadence_update(uint32_t time, const Reading &reading);
+uint32_t cadence_interval();
+// what the readings ask for, before any floor
+uint32_t cadence_wanted();
+
+// for the governor: the interval goes no shorter than this, beyond
+// CADENCE_MAX_S if need be. Keep it on the same grid.
+void cadence_set_floor(uint32_t interval_s);
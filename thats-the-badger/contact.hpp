@@ -1,298 +0,0 @@
-const uint8_t contact_bitmap[] = {
-        0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-        0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-        0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f,
-        0xf3, 0x7e, 0x21, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf7, 0x7e, 0x21, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x16, 0x3e, 0x5d, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0xd7,
-        0x0c, 0x11, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x9b, 0xd0, 0x86, 0x5d, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xd0, 0x8a, 0x39, 0x7b, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0xd6, 0x8a,
-        0x31, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x98, 0x10, 0xcc, 0x41, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf6, 0xb5, 0xad, 0xff, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x09, 0xff, 0x3f, 0xde, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x89, 0xff, 0x3f, 0xde, 0x6e, 0x00, 0x7f, 0xf0, 0x00, 0x03,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe6, 0xb4, 0x72, 0xec,
-        0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x83, 0x83, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1b, 0x31, 0xf4, 0x40, 0xe8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x00, 0x00, 0x00, 0x1c,
-        0x01, 0xc3, 0x83, 0x10, 0x01, 0x00, 0x08, 0x10, 0x38, 0x08, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xc9, 0x36, 0x7d, 0x73, 0x00, 0x03, 0x0c, 0x18, 0x33, 0x3f,
-        0x7f, 0x0f, 0x82, 0xe0, 0x18, 0x66, 0xcf, 0xe3, 0xfe, 0x0f, 0xe1, 0xfe, 0x7c, 0x38, 0x7f, 0x07,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xfe, 0xbc, 0x0d, 0x03, 0x00,
-        0x03, 0x0c, 0x1c, 0x33, 0x0c, 0x18, 0x38, 0xc3, 0xc0, 0x31, 0xfe, 0x6f, 0xe3, 0xfe, 0x1f, 0xf1,
-        0xff, 0xfe, 0x38, 0xff, 0x8f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,
-        0xfe, 0xbc, 0x0d, 0x03, 0x00, 0x03, 0x06, 0x3c, 0x23, 0x08, 0x18, 0x30, 0x63, 0x00, 0x33, 0xfe,
-        0x63, 0x83, 0x8f, 0x3c, 0x71, 0xc7, 0xcf, 0x38, 0xe3, 0x9e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xe9, 0xb0, 0x2d, 0xff, 0x00, 0x03, 0x06, 0x34, 0x63, 0x08, 0x18,
-        0x60, 0x63, 0x00, 0x33, 0x0e, 0x63, 0x83, 0x87, 0x38, 0x39, 0xc3, 0x87, 0x39, 0xc1, 0xdc, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0xd1, 0xb6, 0x1d, 0xeb, 0x00, 0x03,
-        0x02, 0x26, 0x63, 0x08, 0x18, 0x7f, 0xe3, 0x00, 0x77, 0x06, 0x63, 0x83, 0x07, 0x38, 0x39, 0xc3,
-        0x87, 0x39, 0xff, 0xdc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xc8,
-        0xbd, 0x83, 0x0b, 0x00, 0x03, 0x03, 0x66, 0x43, 0x08, 0x18, 0x60, 0x02, 0x00, 0x77, 0x06, 0x63,
-        0x83, 0x07, 0x38, 0x39, 0xc3, 0x87, 0x39, 0xe0, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x8b, 0xf0, 0x82, 0x1c, 0x90, 0x00, 0x03, 0x03, 0x42, 0xc3, 0x08, 0x18, 0x30,
-        0x02, 0x00, 0x33, 0x0e, 0x63, 0x83, 0x07, 0x38, 0x71, 0xc3, 0x87, 0x38, 0xe0, 0x1e, 0x3c, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf0, 0x82, 0x1c, 0x90, 0x00, 0x03, 0x01,
-        0xc3, 0x83, 0x0c, 0x18, 0x30, 0x42, 0x00, 0x33, 0xdf, 0xe3, 0xe3, 0x07, 0x1f, 0xf1, 0xc3, 0x87,
-        0x38, 0xff, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0xee, 0x80,
-        0x7e, 0x6c, 0x00, 0x03, 0x01, 0xc1, 0x83, 0x0f, 0x8f, 0x1f, 0xc2, 0x00, 0x31, 0xff, 0xc3, 0xf3,
-        0x07, 0x0f, 0xe1, 0xc3, 0x87, 0x38, 0x7f, 0x87, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x9f, 0x39, 0xfd, 0x93, 0x13, 0x00, 0x03, 0x00, 0x81, 0x83, 0x07, 0x07, 0x07, 0x02,
-        0x00, 0x18, 0xe3, 0x80, 0xe3, 0x07, 0x07, 0x81, 0x83, 0x06, 0x18, 0x1e, 0x00, 0x1c, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2f, 0xcb, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0x88, 0x2f,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8c, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x0d, 0xff, 0x98, 0x2f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x06, 0xb9, 0xec, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf6, 0x3b, 0x9d, 0x70,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x18, 0x16, 0x89, 0xbc, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0xd6, 0xfb, 0xdf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0xd6, 0xfb, 0xdf, 0xf4, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b,
-        0xd6, 0xfd, 0xa0, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1b, 0xd0, 0x31, 0xb2, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x11, 0x4a, 0x02, 0x7b, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xf7,
-        0x85, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x8f, 0xf3, 0x84, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x0f, 0xf3, 0xde, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x10, 0xef, 0x78, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd1, 0xc6, 0x4c, 0xbd,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0b, 0xd3, 0x10, 0x08, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0xd3, 0x10, 0x08, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8b, 0xd3, 0xd0, 0x70, 0xbd, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
-        0x12, 0x00, 0xcc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0xf2, 0xd6, 0xb4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xc9, 0xc4, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03,
-        0xc9, 0xc4, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
-        0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x88, 0x5f, 0xe8, 0x4b, 0xf9, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xcc, 0xfe, 0xb0, 0xe1, 0x00, 0x1c, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xfd, 0x30,
-        0x87, 0xc1, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x1c, 0x00, 0x00, 0x00,
-        0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x81, 0xfd, 0x70, 0x87, 0xc1, 0x00, 0x3f, 0x1f, 0xe0, 0x3e, 0x0e, 0xf3, 0xe0, 0xe0,
-        0x07, 0x1f, 0xe0, 0x3e, 0x03, 0xf0, 0xe1, 0xc3, 0xf1, 0xd8, 0x7c, 0x1f, 0xc7, 0xf0, 0xf8, 0x3b,
-        0x00, 0x7c, 0x0f, 0x83, 0xfc, 0xf8, 0x00, 0x8e, 0x6d, 0xe6, 0x73, 0x59, 0x00, 0x7f, 0x1f, 0xf0,
-        0xff, 0x8f, 0xff, 0xf0, 0xc7, 0xfb, 0x1f, 0xf8, 0xff, 0x87, 0xf8, 0xe3, 0x87, 0xf9, 0xf8, 0xff,
-        0x3f, 0xe7, 0xf3, 0xfe, 0x3f, 0x01, 0xfe, 0x3f, 0xc3, 0xff, 0xfc, 0x00, 0x06, 0x10, 0x2f, 0xcf,
-        0x21, 0x00, 0x1c, 0x1e, 0x78, 0xe3, 0x8f, 0x3e, 0x79, 0xcf, 0xfb, 0x1e, 0x78, 0xe3, 0x8f, 0x3c,
-        0xe7, 0x0f, 0x39, 0xf9, 0xc7, 0x10, 0xe3, 0xc3, 0x8e, 0x3e, 0x01, 0xc7, 0x78, 0xe3, 0xcf, 0x9e,
-        0x01, 0x03, 0xe1, 0x00, 0x70, 0xe5, 0x00, 0x1c, 0x1c, 0x39, 0xc1, 0xce, 0x1c, 0x39, 0x9c, 0x79,
-        0x9c, 0x3d, 0xc1, 0xde, 0x1c, 0xee, 0x0e, 0x01, 0xe3, 0x83, 0x80, 0xe3, 0x87, 0x07, 0x38, 0x03,
-        0x80, 0x70, 0x73, 0x87, 0x0e, 0x01, 0x86, 0x3d, 0x3f, 0x34, 0x01, 0x00, 0x1c, 0x1c, 0x39, 0xc1,
-        0xce, 0x1c, 0x39, 0x9c, 0x39, 0x9c, 0x1d, 0xc1, 0xdc, 0x1c, 0xfe, 0x1c, 0x01, 0xc3, 0xff, 0x8f,
-        0xe3, 0x87, 0x07, 0x38, 0x03, 0x80, 0x70, 0x73, 0x87, 0x0e, 0x00, 0x86, 0x3d, 0x3f, 0x34, 0x01,
-        0x00, 0x1c, 0x1c, 0x39, 0xc1, 0xce, 0x1c, 0x39, 0x9c, 0x39, 0x9c, 0x1d, 0xc1, 0xdc, 0x1c, 0xff,
-        0x1c, 0x01, 0xc3, 0xff, 0xbf, 0xe3, 0x87, 0x07, 0x38, 0x03, 0x80, 0x70, 0x73, 0x87, 0x0e, 0x00,
-        0x0b, 0xa0, 0x19, 0xf4, 0x39, 0x00, 0x1c, 0x1c, 0x39, 0xc1, 0xce, 0x1c, 0x39, 0x9c, 0x39, 0x9c,
-        0x3d, 0xc1, 0xde, 0x1c, 0xf7, 0x0e, 0x01, 0xc3, 0x80, 0x38, 0xe3, 0x87, 0x07, 0x38, 0x03, 0x80,
-        0x70, 0x73, 0x87, 0x0e, 0x01, 0x0d, 0xdf, 0x08, 0x4f, 0x18, 0x00, 0x1c, 0x1c, 0x38, 0xe3, 0x8e,
-        0x1c, 0x39, 0x9c, 0x7b, 0x1e, 0x78, 0xe3, 0x8f, 0x3c, 0xe3, 0x8f, 0x39, 0xc1, 0xe6, 0x38, 0xe1,
-        0xc3, 0xce, 0x38, 0x79, 0xc7, 0x39, 0xe3, 0x87, 0x0e, 0x01, 0x8d, 0xa3, 0xce, 0xf0, 0xe1, 0x00,
-        0x1f, 0x9c, 0x38, 0xff, 0x8e, 0x1c, 0x38, 0xcf, 0xff, 0x1f, 0xf8, 0xff, 0x87, 0xf8, 0xe3, 0xc7,
-        0xf9, 0xc0, 0xff, 0x3f, 0xe1, 0xf1, 0xfe, 0x38, 0x79, 0xfe, 0x3f, 0xc3, 0x87, 0x0e, 0x00, 0x83,
-        0xd0, 0x00, 0xf0, 0x3d, 0x00, 0x0f, 0x9c, 0x38, 0x3e, 0x0e, 0x1c, 0x38, 0xc7, 0x9e, 0x1f, 0xe0,
-        0x3e, 0x03, 0xe0, 0xe1, 0xe3, 0xf1, 0xc0, 0x7e, 0x1f, 0x60, 0xf0, 0xf8, 0x38, 0x30, 0x7c, 0x0f,
-        0x83, 0x87, 0x0e, 0x00, 0x03, 0xd0, 0x00, 0xf0, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x62, 0xc6, 0x78, 0x21, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8d, 0xb3,
-        0x2f, 0xbf, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x80, 0x02, 0xf0, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x74, 0x39, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0xf3, 0x3f,
-        0x3c, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x88, 0x10, 0x09, 0x8c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd3, 0xd8, 0x0f, 0xe1, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd0, 0x0e, 0x93,
-        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x0b, 0xd0, 0x0e, 0xb3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8b, 0xd1, 0xc0, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x10, 0x30, 0x77, 0x5b,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xf2, 0x11, 0xb7, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x8f, 0xf8, 0x23, 0xd0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1b, 0xde, 0xe2, 0xc0, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0xda, 0x04,
-        0xcc, 0xde, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x8b, 0xdb, 0x04, 0xc4, 0xde, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xdb, 0xa1, 0xe2, 0xde, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd8, 0x40, 0x3e,
-        0xde, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x08, 0x18, 0x20, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xfa, 0x52, 0x52, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfa, 0x5a, 0xd2, 0xff,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x02, 0x1a, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x1b, 0xa0, 0x3d, 0xcf, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x03, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x04, 0x65, 0x3e, 0x37, 0x00,
-        0x20, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x06, 0xe0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x87,
-        0x04, 0x6d, 0xbe, 0x33, 0x00, 0x60, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x06, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x38, 0x00, 0x00, 0x08, 0xf9, 0x9f, 0xe0, 0xc0, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00,
-        0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x70, 0x70,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0x04, 0x27, 0xfc, 0xce, 0x28, 0x00, 0x60,
-        0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-        0x00, 0x00, 0x04, 0x70, 0x70, 0x0e, 0x01, 0xcc, 0x0e, 0x60, 0x38, 0x38, 0x00, 0x01, 0x80, 0x7c,
-        0x05, 0xc2, 0xe0, 0x80, 0x60, 0x0c, 0x6f, 0xc3, 0x0e, 0x3f, 0x03, 0xfc, 0x31, 0xbe, 0x00, 0x7e,
-        0x0f, 0xc3, 0x7c, 0xf8, 0x08, 0x63, 0xfc, 0x0c, 0xfe, 0xfe, 0x3f, 0x87, 0xfe, 0x3f, 0xf0, 0xfe,
-        0x38, 0x00, 0x00, 0x80, 0x7c, 0x05, 0xc6, 0xe0, 0x80, 0x60, 0x0c, 0x78, 0xc3, 0x1c, 0x71, 0x86,
-        0x1c, 0x31, 0xe3, 0x00, 0xe3, 0x18, 0xe3, 0xcf, 0x8c, 0x18, 0x63, 0x8e, 0x0c, 0xfe, 0xfc, 0x7f,
-        0xcf, 0xfe, 0x7f, 0xf1, 0xfe, 0x38, 0x00, 0x00, 0x0f, 0x85, 0xa1, 0xfe, 0xd1, 0x80, 0x60, 0x0c,
-        0x70, 0x63, 0x38, 0x60, 0xcc, 0x0c, 0x31, 0x83, 0x01, 0x80, 0x30, 0x63, 0x87, 0x06, 0x18, 0x63,
-        0x06, 0x08, 0x70, 0x70, 0xe1, 0xce, 0x1e, 0x70, 0xf3, 0x87, 0x38, 0x00, 0x01, 0x03, 0x9e, 0x21,
-        0xd3, 0xee, 0x00, 0x60, 0x0c, 0x60, 0x63, 0x70, 0xc0, 0xcc, 0x0c, 0x31, 0x81, 0x81, 0x80, 0x30,
-        0x33, 0x03, 0x06, 0x10, 0x63, 0x06, 0x18, 0x70, 0x70, 0xe1, 0xce, 0x0e, 0x70, 0x73, 0x87, 0x38,
-        0x00, 0x01, 0x8f, 0x80, 0x19, 0x03, 0xf6, 0x80, 0x60, 0x0c, 0x60, 0x63, 0xf0, 0xff, 0xcc, 0x0c,
-        0x31, 0x81, 0x81, 0x80, 0x20, 0x33, 0x02, 0x06, 0x30, 0x63, 0x02, 0x10, 0x70, 0x70, 0xff, 0xce,
-        0x0e, 0x70, 0x73, 0xff, 0x38, 0x00, 0x00, 0x83, 0x8c, 0xd9, 0x24, 0x6e, 0x00, 0x60, 0x0c, 0x60,
-        0x63, 0x98, 0xc0, 0x0c, 0x0c, 0x31, 0x81, 0x81, 0x80, 0x20, 0x33, 0x02, 0x06, 0x20, 0x63, 0x02,
-        0x30, 0x70, 0x70, 0xe0, 0x0e, 0x1e, 0x70, 0xf3, 0x80, 0x38, 0x00, 0x00, 0x03, 0x9d, 0xd9, 0x2c,
-        0x2e, 0x00, 0x60, 0x0c, 0x60, 0x63, 0x1c, 0x60, 0x0c, 0x0c, 0x31, 0x81, 0x81, 0x80, 0x30, 0x63,
-        0x02, 0x06, 0x20, 0x63, 0x02, 0x30, 0x70, 0x70, 0xf0, 0x0f, 0xbe, 0x7d, 0xf3, 0x80, 0x38, 0x00,
-        0x01, 0x0b, 0xe6, 0x5f, 0xfe, 0xf7, 0x80, 0x60, 0x0c, 0x60, 0x63, 0x0c, 0x70, 0x86, 0x1c, 0x31,
-        0x81, 0x98, 0xc3, 0x38, 0xe3, 0x02, 0x06, 0x60, 0x63, 0x02, 0x20, 0x7e, 0x7e, 0x7f, 0x87, 0xfe,
-        0x3f, 0xf1, 0xfe, 0x38, 0x00, 0x01, 0x8c, 0xb9, 0x81, 0x0e, 0x08, 0x80, 0x7f, 0xcc, 0x60, 0x63,
-        0x06, 0x3f, 0x83, 0xfc, 0x31, 0x81, 0x9c, 0x7e, 0x1f, 0xc3, 0x02, 0x06, 0x40, 0x63, 0x02, 0x60,
-        0x3e, 0x3e, 0x3f, 0x83, 0xee, 0x1f, 0x70, 0xfe, 0x38, 0x00, 0x00, 0x88, 0x31, 0x85, 0xd2, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x08, 0x18, 0x02, 0x00, 0x00,
-        0x00, 0xc0, 0x00, 0x00, 0x60, 0x0c, 0x0c, 0x0e, 0x00, 0x0e, 0x00, 0x70, 0x38, 0x00, 0x00, 0x00,
-        0x08, 0x21, 0x85, 0xd2, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x30,
-        0xe0, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x58, 0x5b, 0x33, 0xf7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0f, 0xfc, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x03, 0x32, 0x18, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f,
-        0xf8, 0x79, 0xee, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x79, 0xee, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x18, 0x5a, 0xce, 0x10, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8b, 0xd9,
-        0xbf, 0xcf, 0xf8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x8b, 0xd9, 0x87, 0xcd, 0x2e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd8, 0x43, 0x8d, 0xff, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0xd8, 0x43,
-        0x0d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x88, 0x19, 0xc4, 0x10, 0x2e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfb, 0x9b, 0xec, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x33, 0x33, 0x33, 0x33,
-        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33
-};
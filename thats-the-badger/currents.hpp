@@ -0,0 +1,12 @@
+#pragma once
+
+// Nominal currents, the same figures the simulator charges for. The phase
+// totals and the governor's plan are both priced from these.
+
+#define MCU_UA 25000
+// the SCD41 measuring
+#define SENSOR_UA 15000
+// the panel while its waveform runs
+#define PANEL_UA 6000
+// the RP2040 asleep with only the RTC clocked, its regulator and the sensor idling
+#define SLEEP_UA 1200
@@ -0,0 +1,125 @@
+#include <cstring>
+
+#include "display.hpp"
+#include "events.hpp"
+#include "phases.hpp"
+
+#define BAND_COUNT (DISPLAY_HEIGHT / 8)
+
+// partial refreshes serialise on the panel's busy flag and each runs the whole
+// waveform, so one bounding window is always cheaper than several small ones
+#define FULL_REFRESH_COVERAGE_PERCENT 50
+#define PARTIALS_BEFORE_FULL_REFRESH 10
+
+static uint8_t shown[DISPLAY_WIDTH * BAND_COUNT];
+static bool shown_valid = false;
+static uint8_t partials = 0;
+static uint32_t full_refreshes = 0;
+static uint32_t partial_refreshes = 0;
+static bool pending = false;
+// columns and bands drawn into since the last send, empty while x0 > x1
+static int damage_x0 = 0, damage_x1 = DISPLAY_WIDTH - 1, damage_band0 = 0, damage_band1 = BAND_COUNT - 1;
+
+// true while the panel is busy, and then its going idle posts EVENT_PANEL_IDLE
+static bool busy() {
+  if (!badger.is_busy()) return false;
+  events_listen_rise(badger.BUSY, EVENT_PANEL_IDLE);
+  // it may have gone idle before the interrupt was on
+  if (badger.is_busy()) return true;
+  events_ignore(badger.BUSY);
+  return false;
+}
+
+static void wait_for_idle() {
+  while (busy()) events_wait(EVENT_PANEL_IDLE);
+}
+
+// the panel has to be idle
+static void send() {
+  uint32_t begin = phase_begin();
+  const uint8_t *frame_buffer = badger.frame_buffer();
+
+  int x0 = 0, x1 = DISPLAY_WIDTH - 1, band0 = 0, band1 = BAND_COUNT - 1;
+  int from = damage_x0, to = damage_x1, band_from = damage_band0, band_to = damage_band1;
+  damage_x0 = DISPLAY_WIDTH, damage_x1 = -1, damage_band0 = BAND_COUNT, damage_band1 = -1;
+  if (shown_valid) {
+    x0 = DISPLAY_WIDTH, x1 = -1, band0 = BAND_COUNT, band1 = -1;
+    for (int x = from; x <= to; ++x) {
+      const uint8_t *column = frame_buffer + x * BAND_COUNT + band_from;
+      const uint8_t *was = shown + x * BAND_COUNT + band_from;
+      if (memcmp(column, was, band_to - band_from + 1) == 0) continue;
+      if (x < x0) x0 = x;
+      x1 = x;
+      for (int band = band_from; band <= band_to; ++band) {
+        if (column[band - band_from] == was[band - band_from]) continue;
+        if (band < band0) band0 = band;
+        if (band > band1) band1 = band;
+      }
+    }
+    if (x1 < 0) return phase_end(PHASE_REFRESH, begin);
+  }
+
+  int w = x1 - x0 + 1;
+  int h = (band1 - band0 + 1) * 8;
+  bool full = !shown_valid || partials >= PARTIALS_BEFORE_FULL_REFRESH ||
+              w * h * 100 >= FULL_REFRESH_COVERAGE_PERCENT * DISPLAY_WIDTH * DISPLAY_HEIGHT;
+
+  if (full) {
+    badger.update();
+    partials = 0;
+    ++full_refreshes;
+    memcpy(shown, frame_buffer, sizeof(shown));
+  } else {
+    badger.partial_update(x0, band0 * 8, w, h);
+    ++partials;
+    ++partial_refreshes;
+    // only the bands that went out, what's outside them may still differ
+    for (int x = x0; x <= x1; ++x) {
+      memcpy(shown + x * BAND_COUNT + band0, frame_buffer + x * BAND_COUNT + band0, band1 - band0 + 1);
+    }
+  }
+  shown_valid = true;
+  phase_end(PHASE_REFRESH, begin);
+}
+
+void display_refresh() {
+  pending = true;
+  display_service();
+}
+
+void display_damage(int x, int y, int w, int h) {
+  if (x < 0) w += x, x = 0;
+  if (y < 0) h += y, y = 0;
+  if (x + w > DISPLAY_WIDTH) w = DISPLAY_WIDTH - x;
+  if (y + h > DISPLAY_HEIGHT) h = DISPLAY_HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+  if (x < damage_x0) damage_x0 = x;
+  if (x + w - 1 > damage_x1) damage_x1 = x + w - 1;
+  if (y / 8 < damage_band0) damage_band0 = y / 8;
+  if ((y + h - 1) / 8 > damage_band1) damage_band1 = (y + h - 1) / 8;
+}
+
+bool display_service() {
+  if (!pending || busy()) return pending;
+  pending = false;
+  send();
+  return false;
+}
+
+void display_finish() {
+  while (display_service()) wait_for_idle();
+  wait_for_idle();
+  events_ignore(badger.BUSY);
+}
+
+void display_invalidate() {
+  shown_valid = false;
+}
+
+uint32_t display_full_refreshes() {
+  return full_refreshes;
+}
+
+uint32_t display_partial_refreshes() {
+  return partial_refreshes;
+}
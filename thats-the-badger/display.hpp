@@ -0,0 +1,40 @@
+#pragma once
+
+#include "badger2040.hpp"
+#include "framebuffer.hpp"
+
+// Badger2040 with access to the UC8151 framebuffer
+class Badger : public pimoroni::Badger2040 {
+public:
+  uint8_t *frame_buffer() { return uc8151.get_frame_buffer(); }
+};
+
+extern Badger badger;
+
+// Sends whatever changed in the framebuffer since the last refresh to the panel.
+// Changes are found by diffing the damaged part against a copy of what was last
+// sent, and go out as one partial update unless they cover too much of the screen or the panel
+// has had enough partials that it needs a full refresh to clear ghosting.
+//
+// The panel refreshes from its own RAM, so the framebuffer is free to draw the
+// next frame into as soon as this returns. If the panel is still busy the
+// refresh waits for display_service to find it idle, and frames drawn in the
+// meantime go out together as one.
+void display_refresh();
+
+// marks a rectangle drawn into since the last refresh, which is all it looks at
+void display_damage(int x, int y, int w, int h);
+
+// sends a waiting refresh once the panel is idle, true while one still waits,
+// which EVENT_PANEL_IDLE will say is worth another try
+bool display_service();
+
+// sends any waiting refresh and waits for the panel to finish, before sleeping
+void display_finish();
+
+// forget what the panel shows, the next refresh will be a full one
+void display_invalidate();
+
+// refreshes sent since boot
+uint32_t display_full_refreshes();
+uint32_t display_partial_refreshes();
@@ -0,0 +1,91 @@
+#include "events.hpp"
+#include "hardware/gpio.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "pico/time.h"
+
+// a button contact bounces for a few ms, edges closer than this are one press
+#define DEBOUNCE_US 20000
+// posted by the timeout alarm, never seen outside
+#define EVENT_TIMEOUT (1u << 31)
+
+static volatile uint32_t posted = 0;
+static volatile uint32_t edges = 0;
+static uint32_t gpio_events[32];
+static uint32_t last_edge_us[32];
+static bool listening[32];
+// the timer stops in deep sleep, so this is cleared whenever a gpio starts
+// listening rather than trusting an old stamp
+static bool bouncing[32];
+static int timeout_alarm = -1;
+
+void events_post(uint32_t events) {
+  uint32_t status = save_and_disable_interrupts();
+  posted |= events;
+  restore_interrupts(status);
+  // for a loop parked in __wfe on either core
+  __sev();
+}
+
+uint32_t events_take(uint32_t mask) {
+  uint32_t status = save_and_disable_interrupts();
+  uint32_t taken = posted & mask;
+  posted &= ~taken;
+  restore_interrupts(status);
+  return taken;
+}
+
+uint32_t events_wait(uint32_t mask) {
+  // an event posted between the check and __wfe has already set the event
+  // register, so __wfe falls straight through
+  uint32_t taken;
+  while (!(taken = events_take(mask))) __wfe();
+  return taken;
+}
+
+static void on_timeout(uint alarm_num) {
+  events_post(EVENT_TIMEOUT);
+}
+
+uint32_t events_wait_until(uint32_t mask, absolute_time_t until) {
+  if (timeout_alarm < 0) {
+    timeout_alarm = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(timeout_alarm, on_timeout);
+  }
+  events_take(EVENT_TIMEOUT);
+  // already gone by
+  if (hardware_alarm_set_target(timeout_alarm, until)) return events_take(mask);
+  uint32_t taken = events_wait(mask | EVENT_TIMEOUT) & mask;
+  hardware_alarm_cancel(timeout_alarm);
+  return taken;
+}
+
+static void on_edge(uint gpio, uint32_t event_mask) {
+  if (gpio >= 32 || !listening[gpio]) return;
+  uint32_t now = time_us_32();
+  if (bouncing[gpio] && now - last_edge_us[gpio] < DEBOUNCE_US) return;
+  bouncing[gpio] = true;
+  last_edge_us[gpio] = now;
+  edges |= 1u << gpio;
+  events_post(gpio_events[gpio]);
+}
+
+void events_listen_rise(uint gpio, uint32_t event) {
+  gpio_events[gpio] = event;
+  listening[gpio] = true;
+  bouncing[gpio] = false;
+  gpio_set_irq_enabled_with_callback(gpio, GPIO_IRQ_EDGE_RISE, true, on_edge);
+}
+
+void events_ignore(uint gpio) {
+  listening[gpio] = false;
+  gpio_set_irq_enabled(gpio, GPIO_IRQ_EDGE_RISE, false);
+}
+
+uint32_t events_take_edges(uint32_t mask) {
+  uint32_t status = save_and_disable_interrupts();
+  uint32_t taken = edges & mask;
+  edges &= ~taken;
+  restore_interrupts(status);
+  return taken;
+}
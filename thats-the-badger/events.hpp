@@ -0,0 +1,38 @@
+#pragma once
+
+#include "pico/platform.h"
+#include "pico/time.h"
+
+// What the main loop waits for while awake. Interrupt handlers post events and
+// the loop sleeps in __wfe until one it cares about turns up, so nothing polls.
+// GPIO edges all come through one handler here, the SDK only keeps one
+// callback per core.
+
+// a button went down, events_take_edges says which
+#define EVENT_BUTTONS (1u << 0)
+// the sensor service has a sample waiting
+#define EVENT_SAMPLE (1u << 1)
+// the panel's busy pin released
+#define EVENT_PANEL_IDLE (1u << 2)
+// the RTC alarm, for deep sleep
+#define EVENT_ALARM (1u << 3)
+// the sensor service ran out of attempts at a sample
+#define EVENT_SAMPLE_FAILED (1u << 4)
+
+// from interrupt handlers or the loop itself
+void events_post(uint32_t events);
+
+// takes whichever of these have been posted, sleeping until at least one has
+uint32_t events_wait(uint32_t mask);
+// the same, but gives up at until and then returns 0
+uint32_t events_wait_until(uint32_t mask, absolute_time_t until);
+// takes whichever of these have been posted, without waiting
+uint32_t events_take(uint32_t mask);
+
+// posts event on every rising edge of the gpio, and remembers the edge for
+// events_take_edges; a gpio that listens twice keeps the second event
+void events_listen_rise(uint gpio, uint32_t event);
+void events_ignore(uint gpio);
+
+// the gpios in mask that have risen since they were last taken
+uint32_t events_take_edges(uint32_t mask);
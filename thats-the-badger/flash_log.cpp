@@ -0,0 +1,180 @@
+#include <cstddef>
+#include <cstring>
+#include "pico/platform.h"
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "flash_log.hpp"
+
+#define RECORD_ERASED 0xff
+
+static uint32_t programs = 0;
+static uint32_t erases = 0;
+
+struct RecordHeader {
+  uint8_t type;
+  uint8_t reserved;
+  uint16_t length;
+  uint32_t sequence;
+  uint32_t crc;
+};
+
+static const uint8_t *sector_base(const FlashLog *log, uint32_t sector) {
+  return (const uint8_t *)(XIP_BASE + log->offset + sector * FLASH_SECTOR_SIZE);
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len) {
+  static const uint32_t nibbles[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+  };
+  crc = ~crc;
+  for (size_t i = 0; i < len; ++i) {
+    crc = nibbles[(crc ^ data[i]) & 0x0f] ^ (crc >> 4);
+    crc = nibbles[(crc ^ (data[i] >> 4)) & 0x0f] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+static uint32_t record_crc(const RecordHeader *header, const void *payload) {
+  uint32_t crc = crc32(0, (const uint8_t *) header, offsetof(RecordHeader, crc));
+  return crc32(crc, (const uint8_t *) payload, header->length);
+}
+
+static uint32_t record_size(uint16_t length) {
+  return (sizeof(RecordHeader) + length + 3) & ~3u;
+}
+
+static const RecordHeader *record_at(const FlashLog *log, uint32_t sector, uint32_t offset) {
+  if (offset + sizeof(RecordHeader) > FLASH_SECTOR_SIZE) return nullptr;
+  const auto *header = (const RecordHeader *)(sector_base(log, sector) + offset);
+  if (header->type == RECORD_ERASED) return nullptr;
+  if (offset + record_size(header->length) > FLASH_SECTOR_SIZE) return nullptr;
+  if (record_crc(header, header + 1) != header->crc) return nullptr;
+  return header;
+}
+
+// programs whole pages padded with 0xff, which leaves already written bytes alone
+static void program(uint32_t offset, const RecordHeader *header, const void *payload) {
+  const uint8_t *parts[2] = {(const uint8_t *) header, (const uint8_t *) payload};
+  uint32_t lengths[2] = {sizeof(RecordHeader), header->length};
+  uint8_t page[FLASH_PAGE_SIZE];
+
+  int part = 0;
+  uint32_t consumed = 0;
+  uint32_t remaining = sizeof(RecordHeader) + header->length;
+  while (remaining) {
+    uint32_t page_start = offset & ~(FLASH_PAGE_SIZE - 1);
+    uint32_t page_offset = offset - page_start;
+    memset(page, 0xff, sizeof(page));
+    while (remaining && page_offset < FLASH_PAGE_SIZE) {
+      uint32_t n = lengths[part] - consumed;
+      if (n > FLASH_PAGE_SIZE - page_offset) n = FLASH_PAGE_SIZE - page_offset;
+      memcpy(page + page_offset, parts[part] + consumed, n);
+      page_offset += n;
+      offset += n;
+      consumed += n;
+      remaining -= n;
+      if (consumed == lengths[part]) {
+        ++part;
+        consumed = 0;
+      }
+    }
+
+    uint32_t ints = save_and_disable_interrupts();
+    flash_range_program(page_start, page, FLASH_PAGE_SIZE);
+    restore_interrupts(ints);
+    ++programs;
+  }
+}
+
+static void write_record(FlashLog *log, uint8_t type, const void *payload, uint16_t length) {
+  RecordHeader header = {type, 0, length, log->next_sequence++, 0};
+  header.crc = record_crc(&header, payload);
+  log->last_record = log->write_offset;
+  program(log->offset + log->active_sector * FLASH_SECTOR_SIZE + log->write_offset, &header, payload);
+  log->write_offset += record_size(length);
+}
+
+static void start_next_sector(FlashLog *log) {
+  log->active_sector = (log->active_sector + 1) % log->sector_count;
+
+  const uint8_t *base = sector_base(log, log->active_sector);
+  bool erased = true;
+  for (uint32_t i = 0; i < FLASH_SECTOR_SIZE && erased; ++i) erased = base[i] == 0xff;
+  if (!erased) {
+    uint32_t ints = save_and_disable_interrupts();
+    flash_range_erase(log->offset + log->active_sector * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE);
+    restore_interrupts(ints);
+    ++erases;
+  }
+
+  log->write_offset = 0;
+  log->has_head = true;
+}
+
+static void replay_sector(FlashLog *log, uint32_t sector, flash_log_visitor visit, void *context) {
+  log->active_sector = sector;
+  log->write_offset = 0;
+  while (const RecordHeader *header = record_at(log, sector, log->write_offset)) {
+    log->last_record = log->write_offset;
+    visit(header->type, (const uint8_t *)(header + 1), header->length, context);
+    log->next_sequence = header->sequence + 1;
+    log->write_offset += record_size(header->length);
+  }
+}
+
+void flash_log_replay(FlashLog *log, flash_log_visitor visit, void *context) {
+  // sectors in the order they were started, by the sequence of their first record
+  uint32_t order[32];
+  uint32_t first_sequence[32];
+  uint32_t count = 0;
+  for (uint32_t sector = 0; sector < log->sector_count && sector < 32; ++sector) {
+    const RecordHeader *first = record_at(log, sector, 0);
+    if (!first) continue;
+    uint32_t i = count++;
+    for (; i > 0 && first_sequence[i - 1] > first->sequence; --i) {
+      order[i] = order[i - 1];
+      first_sequence[i] = first_sequence[i - 1];
+    }
+    order[i] = sector;
+    first_sequence[i] = first->sequence;
+  }
+
+  log->has_head = count > 0;
+  if (!count) return;
+
+  for (uint32_t i = log->checkpointed ? count - 1 : 0; i < count; ++i) replay_sector(log, order[i], visit, context);
+
+  // a torn record means we can't trust the space after it, start afresh next time
+  if (log->write_offset + sizeof(RecordHeader) <= FLASH_SECTOR_SIZE &&
+      sector_base(log, log->active_sector)[log->write_offset] != RECORD_ERASED) {
+    log->write_offset = FLASH_SECTOR_SIZE;
+  }
+}
+
+bool flash_log_append(FlashLog *log, uint8_t type, const void *payload, uint16_t length) {
+  if (!log->has_head || log->write_offset + record_size(length) > FLASH_SECTOR_SIZE) {
+    if (log->checkpointed) return false;
+    start_next_sector(log);
+  }
+  write_record(log, type, payload, length);
+  return true;
+}
+
+void flash_log_checkpoint(FlashLog *log, uint8_t type, const void *payload, uint16_t length) {
+  start_next_sector(log);
+  write_record(log, type, payload, length);
+}
+
+const uint8_t *flash_log_last_payload(const FlashLog *log) {
+  return sector_base(log, log->active_sector) + log->last_record + sizeof(RecordHeader);
+}
+
+uint32_t flash_log_programs() {
+  return programs;
+}
+
+uint32_t flash_log_erases() {
+  return erases;
+}
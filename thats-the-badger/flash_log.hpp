@@ -0,0 +1,59 @@
+#pragma once
+
+#include "pico/platform.h"
+#include "hardware/flash.h"
+
+// Append-only record log over a ring of flash sectors. Records are programmed
+// into erased space a page at a time, so a sector is only erased when the log
+// moves on to it.
+//
+// A checkpointed log starts every sector with a checkpoint record that makes
+// all older sectors redundant, which keeps replay to the newest sector. A plain
+// log simply drops its oldest sector when it wraps, for data that ages out.
+
+// flash layout, everything above the first 256 KiB that holds the program
+#define STATE_LOG_OFFSET (256 * 1024)
+#define STATE_LOG_SECTORS 16
+#define HISTORY_LOG_OFFSET (STATE_LOG_OFFSET + STATE_LOG_SECTORS * FLASH_SECTOR_SIZE)
+#define HISTORY_LOG_SECTORS 9
+#define PHASE_LOG_OFFSET (HISTORY_LOG_OFFSET + HISTORY_LOG_SECTORS * FLASH_SECTOR_SIZE)
+#define PHASE_LOG_SECTORS 2
+
+// at most 32 sectors per log
+struct FlashLog {
+  uint32_t offset;
+  uint32_t sector_count;
+  bool checkpointed;
+
+  // writer position, set up by flash_log_replay
+  uint32_t active_sector;
+  uint32_t write_offset;
+  uint32_t next_sequence;
+  bool has_head;
+  uint32_t last_record;
+};
+
+#define FLASH_LOG(offset, sector_count, checkpointed) \
+  {offset, sector_count, checkpointed, (sector_count) - 1, FLASH_SECTOR_SIZE, 0, false, 0}
+
+typedef void (*flash_log_visitor)(uint8_t type, const uint8_t *payload, uint16_t length, void *context);
+
+// calls visit for every valid record, oldest first, from the newest checkpoint
+// onwards if the log has them, and positions the writer after the last one
+void flash_log_replay(FlashLog *log, flash_log_visitor visit, void *context);
+
+// A plain log moves on to its next sector when this one is full. A checkpointed
+// log returns false instead, or if it has no checkpoint yet, and the caller
+// should write a checkpoint.
+bool flash_log_append(FlashLog *log, uint8_t type, const void *payload, uint16_t length);
+
+// erases the next sector in the ring and starts it with this record
+void flash_log_checkpoint(FlashLog *log, uint8_t type, const void *payload, uint16_t length);
+
+// The payload of the record last appended or replayed, where it can be read in
+// place through XIP until its sector is erased for reuse.
+const uint8_t *flash_log_last_payload(const FlashLog *log);
+
+// pages programmed and sectors erased since boot, over every log
+uint32_t flash_log_programs();
+uint32_t flash_log_erases();
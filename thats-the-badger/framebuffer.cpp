@@ -0,0 +1,99 @@
+#include <cstring>
+
+#include "framebuffer.hpp"
+
+#define BAND_COUNT (DISPLAY_HEIGHT / 8)
+#define COLUMN_WORDS (BAND_COUNT / 4)
+
+void fb_clear(uint8_t *frame_buffer, bool black) {
+  memset(frame_buffer, black ? 0xff : 0x00, DISPLAY_WIDTH * BAND_COUNT);
+}
+
+void fb_fill_rect(uint8_t *frame_buffer, int x, int y, int w, int h, bool black) {
+  if (x < 0) w += x, x = 0;
+  if (y < 0) h += y, y = 0;
+  if (x + w > DISPLAY_WIDTH) w = DISPLAY_WIDTH - x;
+  if (y + h > DISPLAY_HEIGHT) h = DISPLAY_HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+
+  uint8_t *columns = frame_buffer + x * BAND_COUNT;
+  // whole columns are one contiguous run
+  if (h == DISPLAY_HEIGHT) {
+    memset(columns, black ? 0xff : 0x00, w * BAND_COUNT);
+    return;
+  }
+
+  // every column gets the same mask, so build it once in memory order
+  uint8_t mask_bytes[BAND_COUNT] = {};
+  int band0 = y / 8, band1 = (y + h - 1) / 8;
+  for (int band = band0; band <= band1; ++band) mask_bytes[band] = 0xff;
+  mask_bytes[band0] &= 0xff >> (y & 7);
+  mask_bytes[band1] &= 0xff << (7 - ((y + h - 1) & 7));
+
+  uint32_t mask[COLUMN_WORDS];
+  memcpy(mask, mask_bytes, sizeof(mask));
+  int word0 = band0 / 4, word1 = band1 / 4;
+
+  for (int i = 0; i < w; ++i, columns += BAND_COUNT) {
+    for (int word = word0; word <= word1; ++word) {
+      uint32_t value;
+      memcpy(&value, columns + word * 4, 4);
+      value = black ? value | mask[word] : value & ~mask[word];
+      memcpy(columns + word * 4, &value, 4);
+    }
+  }
+}
+
+// 8x8 bit matrix transpose, Hacker's Delight 7-3: rows in, columns out, both
+// MSB first
+static void transpose8(const uint8_t in[8], uint8_t out[8]) {
+  uint32_t x = (uint32_t) in[0] << 24 | in[1] << 16 | in[2] << 8 | in[3];
+  uint32_t y = (uint32_t) in[4] << 24 | in[5] << 16 | in[6] << 8 | in[7];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00aa00aa;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00aa00aa;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000cccc;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000cccc;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xf0f0f0f0) | ((y >> 4) & 0x0f0f0f0f);
+  y = ((x << 4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+  x = t;
+
+  out[0] = x >> 24, out[1] = x >> 16, out[2] = x >> 8, out[3] = x;
+  out[4] = y >> 24, out[5] = y >> 16, out[6] = y >> 8, out[7] = y;
+}
+
+static void or_column(uint8_t *frame_buffer, int x, int y, uint8_t bits) {
+  if (x < 0 || x >= DISPLAY_WIDTH || !bits) return;
+  uint8_t *column = frame_buffer + x * BAND_COUNT;
+  int band = y >> 3, shift = y & 7;
+  if (band >= 0 && band < BAND_COUNT) column[band] |= bits >> shift;
+  if (shift && band + 1 >= 0 && band + 1 < BAND_COUNT) column[band + 1] |= bits << (8 - shift);
+}
+
+void fb_or_rows(uint8_t *frame_buffer, const uint8_t *rows, int stride, int x, int y, int h) {
+  for (int top = 0; top < h; top += 8) {
+    int block_rows = h - top < 8 ? h - top : 8;
+    if (y + top + 8 <= 0 || y + top >= DISPLAY_HEIGHT) continue;
+
+    for (int byte = 0; byte < stride; ++byte) {
+      uint8_t in[8] = {};
+      uint8_t any = 0;
+      for (int row = 0; row < block_rows; ++row) {
+        in[row] = rows[(top + row) * stride + byte];
+        any |= in[row];
+      }
+      if (!any) continue;
+
+      uint8_t out[8];
+      transpose8(in, out);
+      for (int i = 0; i < 8; ++i) or_column(frame_buffer, x + byte * 8 + i, y + top, out[i]);
+    }
+  }
+}
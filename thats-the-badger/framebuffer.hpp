@@ -0,0 +1,21 @@
+#pragma once
+
+#include "pico/platform.h"
+
+#define DISPLAY_WIDTH 296
+#define DISPLAY_HEIGHT 128
+
+// Drawing kernels straight on the UC8151 framebuffer, which is column-major
+// with one byte per 8 rows: byte (y / 8) + x * (DISPLAY_HEIGHT / 8), MSB on
+// top and a set bit for black. They work a word or a whole span of columns at a
+// time where the Badger2040 calls go pixel by pixel. Everything clips to the
+// screen.
+
+void fb_clear(uint8_t *frame_buffer, bool black);
+
+void fb_fill_rect(uint8_t *frame_buffer, int x, int y, int w, int h, bool black);
+
+// ORs h rows of a row-major, MSB first 1bpp bitmap, stride bytes to a row, in
+// with its top left corner at x, y. Rows go in 8 at a time as transposed
+// blocks, all white blocks are skipped.
+void fb_or_rows(uint8_t *frame_buffer, const uint8_t *rows, int stride, int x, int y, int h);
@@ -0,0 +1,169 @@
+#include <cstring>
+
+#include "display.hpp"
+#include "glyph_atlas.hpp"
+#include "glyph_atlas_data.hpp"
+#include "trace.hpp"
+
+#define BAND_COUNT (DISPLAY_HEIGHT / 8)
+
+struct FaceSpec {
+  const char *font;
+  float scale;
+  uint8_t thickness;
+};
+
+// for text the atlas can't draw
+static const FaceSpec faces[FACE_COUNT] = {
+#define GLYPH_FACE(name, font, scale, thickness, charset) {font, scale, thickness},
+#include "glyph_faces.h"
+#undef GLYPH_FACE
+};
+
+static int utf8_length(uint8_t lead) {
+  if (lead < 0x80) return 1;
+  if ((lead & 0xe0) == 0xc0) return 2;
+  if ((lead & 0xf0) == 0xe0) return 3;
+  return 4;
+}
+
+// reads one character, never past the terminator
+static int next_code(const char *text, uint32_t *code) {
+  int length = utf8_length((uint8_t) text[0]);
+  *code = 0;
+  for (int i = 0; i < length; ++i) {
+    if (!text[i]) return i;
+    *code |= (uint32_t) (uint8_t) text[i] << (8 * i);
+  }
+  return length;
+}
+
+static void select_face(const FaceSpec &spec) {
+  badger.font(spec.font);
+  badger.thickness(spec.thickness);
+  badger.pen(0);
+}
+
+static const Glyph *find(const Atlas &atlas, uint32_t code) {
+  for (int i = atlas.first; i < atlas.first + atlas.count; ++i) {
+    if (atlas_glyphs[i].code == code) return &atlas_glyphs[i];
+  }
+  return nullptr;
+}
+
+// true if the face's atlas holds every character of the text
+static bool holds(const Atlas &atlas, const char *text) {
+  uint32_t code;
+  for (const char *c = text; *c;) {
+    c += next_code(c, &code);
+    if (!find(atlas, code)) return false;
+  }
+  return true;
+}
+
+#if GLYPH_ATLAS_CHECK
+// faces that drew differently from the library, which draws them from then on
+static bool mismatched[FACE_COUNT];
+#endif
+
+// true if the atlas draws the text for the face
+static bool usable(Face face, const char *text) {
+#if GLYPH_ATLAS_CHECK
+  if (mismatched[face]) return false;
+#endif
+  return holds(atlases[face], text);
+}
+
+static int32_t width_of(const Atlas &atlas, const char *text) {
+  int32_t width = 0;
+  uint32_t code;
+  for (const char *c = text; *c;) {
+    c += next_code(c, &code);
+    width += find(atlas, code)->advance;
+  }
+  return width;
+}
+
+int32_t atlas_measure(Face face, const char *text) {
+  if (!usable(face, text)) {
+    select_face(faces[face]);
+    return badger.measure_text(text, faces[face].scale);
+  }
+  return width_of(atlases[face], text);
+}
+
+static void blit(const Glyph &glyph, int32_t x, int32_t y) {
+  uint8_t *frame_buffer = badger.frame_buffer();
+  const uint8_t *column = atlas_pool + glyph.offset;
+  int32_t top = y + glyph.top;
+  int shift = top & 7;
+  int32_t band0 = top >> 3;
+
+  for (int i = 0; i < glyph.width; ++i, column += glyph.bands) {
+    int32_t px = x + glyph.left + i;
+    if (px < 0 || px >= DISPLAY_WIDTH) continue;
+
+    // at most seven bands, so a shifted column still fits
+    uint64_t bits = 0;
+    for (int band = 0; band < glyph.bands; ++band) bits |= (uint64_t) column[band] << (56 - 8 * band);
+    bits >>= shift;
+
+    uint8_t *out = frame_buffer + px * BAND_COUNT;
+    for (int band = 0; band <= glyph.bands; ++band) {
+      int32_t b = band0 + band;
+      uint8_t byte = bits >> (56 - 8 * band);
+      if (byte && b >= 0 && b < BAND_COUNT) out[b] |= byte;
+    }
+  }
+}
+
+static void draw(const Atlas &atlas, const char *text, int32_t x, int32_t y) {
+  uint32_t code;
+  for (const char *c = text; *c;) {
+    c += next_code(c, &code);
+    const Glyph *glyph = find(atlas, code);
+    blit(*glyph, x, y);
+    x += glyph->advance;
+  }
+}
+
+#if GLYPH_ATLAS_CHECK
+static uint8_t saved[DISPLAY_WIDTH * BAND_COUNT];
+static uint8_t drawn[DISPLAY_WIDTH * BAND_COUNT];
+
+// Draws the text both ways on a blank frame and puts the frame back after. A
+// face that differs in a pixel or in width is traced and left to the library.
+static void check(Face face, const char *text, int32_t x, int32_t y) {
+  uint8_t *frame_buffer = badger.frame_buffer();
+  memcpy(saved, frame_buffer, sizeof(saved));
+  memset(frame_buffer, 0, sizeof(saved));
+  draw(atlases[face], text, x, y);
+  memcpy(drawn, frame_buffer, sizeof(drawn));
+  memset(frame_buffer, 0, sizeof(saved));
+  select_face(faces[face]);
+  badger.text(text, x, y, faces[face].scale);
+
+  int column = 0;
+  for (; column < DISPLAY_WIDTH; ++column) {
+    if (memcmp(drawn + column * BAND_COUNT, frame_buffer + column * BAND_COUNT, BAND_COUNT)) break;
+  }
+  int32_t wider = width_of(atlases[face], text) - badger.measure_text(text, faces[face].scale);
+  memcpy(frame_buffer, saved, sizeof(saved));
+
+  if (column < DISPLAY_WIDTH) TRACE_ERROR(GLYPH_ATLAS_MISMATCH, face, column);
+  if (wider) TRACE_ERROR(GLYPH_ATLAS_WIDTH_MISMATCH, face, wider);
+  mismatched[face] = column < DISPLAY_WIDTH || wider;
+}
+#endif
+
+void atlas_text(Face face, const char *text, int32_t x, int32_t y) {
+#if GLYPH_ATLAS_CHECK
+  if (usable(face, text)) check(face, text, x, y);
+#endif
+  if (!usable(face, text)) {
+    select_face(faces[face]);
+    badger.text(text, x, y, faces[face].scale);
+    return;
+  }
+  draw(atlases[face], text, x, y);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// 1 draws every atlas text with the library as well, on a blank frame, and
+// compares the two; see atlas_text().
+#ifndef GLYPH_ATLAS_CHECK
+#define GLYPH_ATLAS_CHECK 0
+#endif
+
+// The faces in glyph_faces.h, rasterised at build time by tools/glyph_atlas.py
+// from the same font tables and drawing rules as the Badger2040 text calls and
+// kept in flash as 1bpp bitmaps with their advances. Measuring is a table
+// lookup and drawing is a copy into the framebuffer.
+enum Face : uint8_t {
+#define GLYPH_FACE(name, font, scale, thickness, charset) FACE_##name,
+#include "glyph_faces.h"
+#undef GLYPH_FACE
+  FACE_COUNT
+};
+
+struct Glyph {
+  // the character's UTF-8 bytes, first byte lowest
+  uint32_t code;
+  int16_t advance;
+  // bitmap position relative to the pen, top is a multiple of 8
+  int16_t left;
+  int16_t top;
+  uint8_t width;
+  uint8_t bands;
+  // into the pool, column-major like the framebuffer, bands bytes per column
+  uint16_t offset;
+};
+
+// a face's run of glyphs, as generated into glyph_atlas_data.hpp
+struct Atlas {
+  uint8_t first;
+  uint8_t count;
+};
+
+int32_t atlas_measure(Face face, const char *text);
+
+// Draws in black, pixel for pixel where badger.text() would at x, y. Text with
+// characters the face doesn't hold falls back to badger.text(), which can
+// leave the badger's font, thickness and pen changed; so can atlas_measure().
+// With GLYPH_ATLAS_CHECK a face that draws or measures any differently from
+// badger.text() is traced and falls back for good, until the next boot.
+void atlas_text(Face face, const char *text, int32_t x, int32_t y);
@@ -0,0 +1,19 @@
+// Every font, scale and thickness combination the screens draw text in, with
+// each character it is ever asked for, UTF-8. tools/glyph_atlas.py reads this
+// file to rasterise them at build time, so keep one per line.
+//
+// The chart faces all come out in bitmap8: the Badger2040 library has no
+// bitmap4 or bitmap16_outline and ignores unknown font names.
+
+// readings along the bottom of the badge
+GLYPH_FACE(BADGE_READING, "sans", 0.7f, 2, "-0123456789")
+// chart axis limits
+GLYPH_FACE(CHART_AXIS, "bitmap8", 1, 1, "-0123456789")
+// chart names
+GLYPH_FACE(CHART_NAME, "bitmap8", 1, 2, "2CEHMOPRT")
+// latest value and unit beside each chart
+GLYPH_FACE(CHART_VALUE, "bitmap8", 2, 1, "-0123456789%mp\xc2\xb0" "C")
+// chart range
+GLYPH_FACE(CHART_RANGE, "bitmap8", 1, 1, "1DHW")
+// phase timings, the headings, phase names and figures
+GLYPH_FACE(TIMINGS, "bitmap8", 1, 1, " .0123456789Aabcdefhiklmnoprstuwxy")
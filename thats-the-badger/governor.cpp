@@ -0,0 +1,174 @@
+#include "governor.hpp"
+#include "cadence.hpp"
+#include "currents.hpp"
+#include "display.hpp"
+#include "flash_log.hpp"
+#include "phases.hpp"
+#include "trace.hpp"
+
+// nominal, as the simulator has it
+#define BATTERY_MAH 1000
+// Charges in uA*ms. A single shot measures for 5 s, and a flash page programs
+// in 400 us and a sector erases in 45 ms with the MCU up.
+#define SAMPLE_UAMS (SENSOR_UA * 5000ull)
+#define FLASH_PROGRAM_UAMS (MCU_UA * 4ull / 10)
+#define FLASH_ERASE_UAMS (MCU_UA * 45ull)
+// a partial refresh drives about half as many pixels for the same time
+#define PARTIAL_PERMILLE 500
+
+#define PLAN_INTERVAL_S (60 * 60)
+// a battery this full at boot is taken to be a new one
+#define FRESH_PERCENT 90
+
+// waveform times for each update speed, as the UC8151 driver has them
+static const uint32_t update_ms[] = {4500, 2000, 800, 250};
+
+// most generous first
+static const Policy levels[] = {
+  // as often as the readings move
+  {CADENCE_MIN_S, false, 1, true},
+  // no faster than the old fixed five minutes
+  {4 * CADENCE_MIN_S, false, 1, true},
+  // the fast waveform ghosts a little, but the MCU waits on it for less
+  {8 * CADENCE_MIN_S, false, 2, true},
+  {16 * CADENCE_MIN_S, false, 2, true},
+  // the history carries on, but only a press shows it
+  {32 * CADENCE_MIN_S, false, 2, false},
+};
+#define LEVEL_COUNT (sizeof(levels) / sizeof(levels[0]))
+
+static const Policy powered = {CADENCE_MIN_S, true, 1, true};
+
+static Policy policy = levels[0];
+static bool planned = false;
+static uint32_t planned_at = 0;
+static bool on_usb = false;
+static bool fitting_checked = false;
+
+// counts since boot, the window between plans is the difference of two
+struct Tally {
+  uint32_t wakes;
+  uint64_t awake_us;
+  uint64_t idle_wait_us;
+  uint32_t full_refreshes;
+  uint32_t partial_refreshes;
+  uint32_t flash_programs;
+  uint32_t flash_erases;
+};
+
+static Tally since = {};
+static bool window_on_usb = false;
+static uint64_t wanted_s = 0;
+static uint32_t wanted_count = 0;
+
+// Learned from the last window on battery, to start with a wake that samples
+// and refreshes the whole panel once. A wake's charge apart from its refreshes:
+static uint64_t wake_uams = (uint64_t) MCU_UA * 5000 + SAMPLE_UAMS;
+// and per wake in thousandths, refreshes, and the panel driven as a whole
+static uint32_t refresh_permille = 1000;
+static uint32_t drive_permille = 1000;
+// what the readings ask of the cadence, unfloored
+static uint32_t pace_s = CADENCE_MAX_S;
+
+static Tally tally() {
+  Tally t;
+  t.wakes = phase_stats(PHASE_AWAKE).count;
+  t.awake_us = phase_stats(PHASE_AWAKE).total_us;
+  t.idle_wait_us = phase_stats(PHASE_WAIT_FOR_IDLE).total_us;
+  t.full_refreshes = display_full_refreshes();
+  t.partial_refreshes = display_partial_refreshes();
+  t.flash_programs = flash_log_programs();
+  t.flash_erases = flash_log_erases();
+  return t;
+}
+
+// prices the wakes since the last plan, unless the sensor ran off USB for any of them
+static void learn() {
+  Tally now = tally();
+  uint32_t wakes = now.wakes - since.wakes;
+  if (wakes && !window_on_usb) {
+    // the MCU waiting for the last refresh is priced with the refreshes
+    uint64_t awake_us = (now.awake_us - since.awake_us) - (now.idle_wait_us - since.idle_wait_us);
+    uint32_t full = now.full_refreshes - since.full_refreshes;
+    uint32_t partial = now.partial_refreshes - since.partial_refreshes;
+    uint64_t charge = awake_us * MCU_UA / 1000 +
+                      (now.flash_programs - since.flash_programs) * FLASH_PROGRAM_UAMS +
+                      (now.flash_erases - since.flash_erases) * FLASH_ERASE_UAMS;
+    wake_uams = charge / wakes + SAMPLE_UAMS;
+    refresh_permille = (full + partial) * 1000 / wakes;
+    drive_permille = (full * 1000 + partial * PARTIAL_PERMILLE) / wakes;
+  }
+  // averaged over a few hours, a meeting shouldn't swing the plan back and forth
+  if (wanted_count) pace_s = (pace_s + wanted_s / wanted_count) / 2;
+
+  since = now;
+  window_on_usb = false;
+  wanted_s = 0;
+  wanted_count = 0;
+}
+
+// average current in uA with this policy
+static uint64_t drain_ua(const Policy &level) {
+  uint64_t per_wake = wake_uams;
+  if (level.refresh_on_sample) {
+    per_wake += ((uint64_t) MCU_UA * refresh_permille + (uint64_t) PANEL_UA * drive_permille) *
+                update_ms[level.update_speed] / 1000;
+  }
+  uint32_t interval_s = pace_s > level.min_interval_s ? pace_s : level.min_interval_s;
+  return SLEEP_UA + per_wake / ((uint64_t) interval_s * 1000);
+}
+
+static void plan(uint32_t time, const Supply &supply, const State &state) {
+  if (supply.usb) {
+    policy = powered;
+    TRACE_INFO(GOVERNOR_PLAN, -1, supply.battery_mv);
+  } else {
+    // past the target, what's left is stretched as far as it goes
+    uint32_t level = LEVEL_COUNT - 1;
+    uint32_t target = state.battery_fitted + GOVERNOR_TARGET_DAYS * 24 * 60 * 60;
+    if (target > time) {
+      uint64_t left_uams = (uint64_t) BATTERY_MAH * 1000 * 60 * 60 * 1000 * battery_percent(supply.battery_mv) / 100;
+      uint64_t budget_ua = left_uams / ((uint64_t) (target - time) * 1000);
+      for (level = 0; level < LEVEL_COUNT - 1; ++level) {
+        if (drain_ua(levels[level]) <= budget_ua) break;
+      }
+    }
+    policy = levels[level];
+    TRACE_INFO(GOVERNOR_PLAN, level, supply.battery_mv);
+  }
+  cadence_set_floor(policy.min_interval_s);
+}
+
+bool governor_update(uint32_t time, State *state) {
+  Supply supply = battery_read();
+  if (supply.usb) window_on_usb = true;
+  wanted_s += cadence_wanted();
+  ++wanted_count;
+
+  // cold boots are rare, a battery going in is the usual one
+  bool fitted = false;
+  if (!fitting_checked && !supply.usb) {
+    fitting_checked = true;
+    uint8_t percent = battery_percent(supply.battery_mv);
+    if (!state->battery_fitted || percent >= FRESH_PERCENT) {
+      state->battery_fitted = time;
+      fitted = true;
+      TRACE_INFO(BATTERY_FITTED, supply.battery_mv, percent);
+    }
+  }
+
+  if (!planned || fitted || supply.usb != on_usb || time - planned_at >= PLAN_INTERVAL_S) {
+    // phase stats carry over from before boot, the other counts don't
+    if (planned) learn();
+    else since = tally();
+    plan(time, supply, *state);
+    planned = true;
+    planned_at = time;
+    on_usb = supply.usb;
+  }
+  return fitted;
+}
+
+const Policy &governor_policy() {
+  return policy;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "battery.hpp"
+#include "state.hpp"
+
+// Spends the battery so it lasts GOVERNOR_TARGET_DAYS from when it went in.
+// Each wake is priced from what it did, its awake time, the sample, refreshes
+// and flash writes, and about hourly the governor works out what's left from
+// the battery voltage and picks the most generous policy whose drain still
+// gets there. On USB nothing is rationed.
+
+#define GOVERNOR_TARGET_DAYS 21
+
+struct Policy {
+    // the cadence goes no shorter than this
+    uint32_t min_interval_s;
+    // periodic measurement carries on through deep sleep, so a wake has its
+    // reading without waiting out a single shot
+    bool sensor_running;
+    // the panel's waveform, see Badger2040::update_speed
+    uint8_t update_speed;
+    // a new sample redraws the screen, otherwise only a press does
+    bool refresh_on_sample;
+};
+
+// Once a wake, before it samples. Re-plans at most hourly, and straight away
+// after boot, when a battery that reads as fresh starts the target over in
+// state. True if state changed and wants storing.
+bool governor_update(uint32_t time, State *state);
+const Policy &governor_policy();
@@ -0,0 +1,584 @@
+#include <cstring>
+
+#include "flash_log.hpp"
+#include "history.hpp"
+#include "series.hpp"
+
+#define TEN_MINUTES_S (10 * 60)
+#define HOUR_S (60 * 60)
+#define DAY_S (24 * HOUR_S)
+#define WEEK_S (7 * DAY_S)
+
+// each log keeps at least one sector more than its tier holds
+#define RAW_LOG_SECTORS 2
+#define TEN_MINUTE_LOG_SECTORS 3
+#define HOURLY_LOG_SECTORS 4
+
+#define RAW_LOG_OFFSET HISTORY_LOG_OFFSET
+#define TEN_MINUTE_LOG_OFFSET (RAW_LOG_OFFSET + RAW_LOG_SECTORS * FLASH_SECTOR_SIZE)
+#define HOURLY_LOG_OFFSET (TEN_MINUTE_LOG_OFFSET + TEN_MINUTE_LOG_SECTORS * FLASH_SECTOR_SIZE)
+
+static_assert(RAW_LOG_SECTORS + TEN_MINUTE_LOG_SECTORS + HOURLY_LOG_SECTORS <= HISTORY_LOG_SECTORS,
+              "the history logs overrun their space in the flash layout");
+
+// single raw samples, as older firmware wrote them, are no longer replayed
+#define RECORD_SAMPLE 1
+#define RECORD_BUCKET 2
+#define RECORD_SAMPLE_BLOCK 3
+#define RECORD_BUCKET_BATCH 4
+
+// Raw samples go into a compressed block in RAM, which survives deep sleep, and
+// the block goes to the raw log once it is full or spans an hour. A battery
+// pull loses at most that hour, which the ten minute tier still summarises.
+#define BLOCK_SPAN_S HOUR_S
+// Sealed blocks are read in place in flash. Keeping the newest few covers the
+// hour at any sample interval the sensor can manage, and a plain log only
+// erases its oldest sector, long after the hour has moved on.
+#define RECENT_BLOCKS 8
+// Closed ten minute buckets wait in RAM too and go out an hour's worth at a
+// time in one record, a page program or two instead of six. They are rebuilt
+// from the sealed blocks on replay, so a battery pull loses no more than the
+// raw hour would anyway.
+#define TEN_MINUTE_BATCH 6
+
+struct Sample {
+  uint32_t time;
+  Reading reading;
+};
+
+// min, max and mean per metric, packed the same way as a sample
+struct Bucket {
+  uint32_t time;
+  uint16_t count;
+  Reading min;
+  Reading max;
+  Reading mean;
+};
+
+template <typename T, int N>
+class Ring {
+public:
+  void push(const T &item) {
+    items[(start + count) % N] = item;
+    if (count < N) ++count;
+    else start = (start + 1) % N;
+  }
+
+  int size() const { return count; }
+  const T &operator[](int index) const { return items[(start + index) % N]; }
+
+private:
+  T items[N];
+  int start = 0;
+  int count = 0;
+};
+
+// folds extremes and weighted sums together for a range's summary
+struct Stats {
+  int32_t min = 0;
+  int32_t max = 0;
+  int64_t sum = 0;
+  uint32_t count = 0;
+
+  void add(int32_t low, int32_t high, int64_t total, uint32_t n) {
+    if (!count || low < min) min = low;
+    if (!count || high > max) max = high;
+    sum += total;
+    count += n;
+  }
+
+  HistoryPoint point(uint32_t time) const {
+    return {time, min, max, count ? (int32_t) ((sum + (sum < 0 ? -(int64_t) count : count) / 2) / count) : 0};
+  }
+};
+
+// the bucket that is still filling up
+class Accumulator {
+public:
+  uint32_t time = 0;
+  uint16_t count = 0;
+
+  void add(const Bucket &bucket) {
+    for (int m = 0; m < METRIC_COUNT; ++m) {
+      int32_t low = reading_value(bucket.min, (Metric) m);
+      int32_t high = reading_value(bucket.max, (Metric) m);
+      if (!count || low < min[m]) min[m] = low;
+      if (!count || high > max[m]) max[m] = high;
+      sum[m] = (count ? sum[m] : 0) + reading_value(bucket.mean, (Metric) m) * bucket.count;
+    }
+    count += bucket.count;
+  }
+
+  Bucket bucket() const {
+    Bucket bucket = {time, count};
+    for (int m = 0; m < METRIC_COUNT; ++m) {
+      set_reading_value(&bucket.min, (Metric) m, min[m]);
+      set_reading_value(&bucket.max, (Metric) m, max[m]);
+      set_reading_value(&bucket.mean, (Metric) m, (sum[m] + (sum[m] < 0 ? -count : count) / 2) / count);
+    }
+    return bucket;
+  }
+
+  void add_to(Stats *stats, Metric metric) const {
+    if (count) stats->add(min[metric], max[metric], sum[metric], count);
+  }
+
+private:
+  int32_t min[METRIC_COUNT];
+  int32_t max[METRIC_COUNT];
+  int32_t sum[METRIC_COUNT];
+};
+
+// Values that can still become the window's extreme once older ones leave it,
+// oldest first. A new value drops every value it beats, so each push and
+// expiry is O(1) amortised.
+template <int N, bool Lowest>
+class Extremes {
+public:
+  void push(uint32_t sequence, int32_t value) {
+    while (length && (Lowest ? back().value >= value : back().value <= value)) --length;
+    entries[(head + length++) % N] = {sequence, value};
+  }
+
+  void expire(uint32_t sequence) {
+    if (length && entries[head].sequence == sequence) {
+      head = (head + 1) % N;
+      --length;
+    }
+  }
+
+  int32_t front() const { return entries[head].value; }
+
+private:
+  struct Entry {
+    uint32_t sequence;
+    int32_t value;
+  };
+
+  const Entry &back() const { return entries[(head + length - 1) % N]; }
+
+  Entry entries[N];
+  int head = 0;
+  int length = 0;
+};
+
+// running min, max and sum over the newest points of a tier, the ones inside
+// its chart range
+template <int N>
+class Window {
+public:
+  int size() const { return next - first; }
+
+  void push(const Bucket &bucket) {
+    for (int m = 0; m < METRIC_COUNT; ++m) {
+      lows[m].push(next, reading_value(bucket.min, (Metric) m));
+      highs[m].push(next, reading_value(bucket.max, (Metric) m));
+      sum[m] += (int64_t) reading_value(bucket.mean, (Metric) m) * bucket.count;
+    }
+    count += bucket.count;
+    ++next;
+  }
+
+  // the oldest point leaves
+  void pop(const Bucket &bucket) {
+    for (int m = 0; m < METRIC_COUNT; ++m) {
+      lows[m].expire(first);
+      highs[m].expire(first);
+      sum[m] -= (int64_t) reading_value(bucket.mean, (Metric) m) * bucket.count;
+    }
+    count -= bucket.count;
+    ++first;
+  }
+
+  void add_to(Stats *stats, Metric metric) const {
+    if (size()) stats->add(lows[metric].front(), highs[metric].front(), sum[metric], count);
+  }
+
+private:
+  Extremes<N, true> lows[METRIC_COUNT];
+  Extremes<N, false> highs[METRIC_COUNT];
+  int64_t sum[METRIC_COUNT] = {};
+  uint32_t count = 0;
+  uint32_t first = 0;
+  uint32_t next = 0;
+};
+
+static FlashLog raw_log = FLASH_LOG(RAW_LOG_OFFSET, RAW_LOG_SECTORS, false);
+static FlashLog ten_minute_log = FLASH_LOG(TEN_MINUTE_LOG_OFFSET, TEN_MINUTE_LOG_SECTORS, false);
+static FlashLog hourly_log = FLASH_LOG(HOURLY_LOG_OFFSET, HOURLY_LOG_SECTORS, false);
+
+struct SealedBlock {
+  const uint8_t *data;
+  uint16_t length;
+  uint32_t last_time;
+};
+
+static SeriesEncoder open_block;
+static Ring<SealedBlock, RECENT_BLOCKS> recent_blocks;
+static Ring<Bucket, HISTORY_TEN_MINUTE_COUNT> ten_minutes;
+static Ring<Bucket, HISTORY_HOURLY_COUNT> hours;
+static Accumulator open_ten_minutes;
+static Accumulator open_hour;
+
+static Window<HISTORY_RAW_COUNT> last_hour;
+static Window<HISTORY_TEN_MINUTE_COUNT> last_day;
+static Window<HISTORY_HOURLY_COUNT> last_week;
+
+// The oldest sample in the hour's window and where it sits in the blocks: the
+// taken'th sample of block, where the open block comes after recent_blocks.
+// The hour keeps no copy of its samples, the next oldest is decoded as each
+// one leaves, so every sample is decoded once more on its way out.
+struct HourTail {
+  Sample front;
+  int block;
+  uint16_t taken;
+  // the decoder is at taken in block
+  bool started;
+  SeriesDecoder decoder;
+};
+
+static HourTail hour_tail = {};
+
+static Sample latest = {};
+static Bucket unsaved_ten_minutes[TEN_MINUTE_BATCH];
+static int unsaved_count = 0;
+
+int32_t reading_value(const Reading &reading, Metric metric) {
+  switch (metric) {
+    case CO2: return reading.co2;
+    case Temperature: return reading.temperature;
+    default: return reading.humidity;
+  }
+}
+
+void set_reading_value(Reading *reading, Metric metric, int32_t value) {
+  switch (metric) {
+    case CO2: reading->co2 = value; break;
+    case Temperature: reading->temperature = value; break;
+    default: reading->humidity = value; break;
+  }
+}
+
+int32_t metric_divisor(Metric metric) {
+  return metric == CO2 ? 1 : 100;
+}
+
+static Bucket tier_bucket(const Sample &sample) {
+  return {sample.time, 1, sample.reading, sample.reading, sample.reading};
+}
+
+static const Bucket &tier_bucket(const Bucket &bucket) {
+  return bucket;
+}
+
+template <typename T, int N>
+static void tier_push(Ring<T, N> *tier, Window<N> *window, const T &item) {
+  if (window->size() == N) window->pop(tier_bucket((*tier)[0]));
+  tier->push(item);
+  window->push(tier_bucket(item));
+}
+
+// the window keeps only the newest points inside the chart range
+template <typename T, int N>
+static void trim(const Ring<T, N> &tier, Window<N> *window, uint32_t span) {
+  uint32_t start = latest.time >= span ? latest.time - span + 1 : 0;
+  while (window->size() && tier[tier.size() - window->size()].time < start) {
+    window->pop(tier_bucket(tier[tier.size() - window->size()]));
+  }
+}
+
+static void close_hour(bool persist) {
+  Bucket bucket = open_hour.bucket();
+  tier_push(&hours, &last_week, bucket);
+  open_hour.count = 0;
+  if (persist) flash_log_append(&hourly_log, RECORD_BUCKET, &bucket, sizeof(bucket));
+}
+
+static void add_to_hour(const Bucket &bucket, bool persist) {
+  uint32_t hour = bucket.time - bucket.time % HOUR_S;
+  if (open_hour.count && open_hour.time != hour) close_hour(persist);
+  if (!open_hour.count) open_hour.time = hour;
+  open_hour.add(bucket);
+}
+
+static void save_ten_minutes() {
+  if (!unsaved_count) return;
+  flash_log_append(&ten_minute_log, RECORD_BUCKET_BATCH, unsaved_ten_minutes, unsaved_count * sizeof(Bucket));
+  unsaved_count = 0;
+}
+
+static void close_ten_minutes(bool persist) {
+  Bucket bucket = open_ten_minutes.bucket();
+  tier_push(&ten_minutes, &last_day, bucket);
+  open_ten_minutes.count = 0;
+  if (persist) {
+    unsaved_ten_minutes[unsaved_count++] = bucket;
+    if (unsaved_count == TEN_MINUTE_BATCH) save_ten_minutes();
+  }
+  add_to_hour(bucket, persist);
+}
+
+static void add_to_ten_minutes(const Sample &sample, bool persist) {
+  uint32_t ten_minute = sample.time - sample.time % TEN_MINUTES_S;
+  if (open_ten_minutes.count && open_ten_minutes.time != ten_minute) close_ten_minutes(persist);
+  if (!open_ten_minutes.count) open_ten_minutes.time = ten_minute;
+  open_ten_minutes.add(tier_bucket(sample));
+}
+
+static void rebuild_hour();
+
+static void seal_block() {
+  bool dropping = recent_blocks.size() == RECENT_BLOCKS;
+  flash_log_append(&raw_log, RECORD_SAMPLE_BLOCK, open_block.data(), open_block.size());
+  recent_blocks.push({flash_log_last_payload(&raw_log), open_block.size(), latest.time});
+  open_block.clear();
+
+  // the open block's samples are now the newest sealed block's, at the same
+  // place, but the decoder was reading them from RAM
+  hour_tail.started = false;
+  if (dropping && --hour_tail.block < 0 && last_hour.size()) rebuild_hour();
+}
+
+static void add_to_block(const Sample &sample) {
+  if (open_block.count() && sample.time >= open_block.first_time() + BLOCK_SPAN_S) seal_block();
+  if (!open_block.append(sample.time, sample.reading)) {
+    seal_block();
+    open_block.append(sample.time, sample.reading);
+  }
+}
+
+// the block'th of the recent blocks, then the open one
+static bool start_block(SeriesDecoder *decoder, int block) {
+  if (block < recent_blocks.size()) {
+    decoder->start(recent_blocks[block].data, recent_blocks[block].length);
+  } else if (block == recent_blocks.size()) {
+    decoder->start(open_block.data(), open_block.size());
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// moves the tail on to the next sample, there is one while the window isn't empty
+static bool next_tail(Sample *sample) {
+  while (true) {
+    if (!hour_tail.started) {
+      if (!start_block(&hour_tail.decoder, hour_tail.block)) return false;
+      for (uint16_t i = 0; i < hour_tail.taken; ++i) hour_tail.decoder.next(&sample->time, &sample->reading);
+      hour_tail.started = true;
+    }
+    if (hour_tail.decoder.next(&sample->time, &sample->reading)) {
+      ++hour_tail.taken;
+      return true;
+    }
+    hour_tail.started = false;
+    // the open block may have grown since the decoder started on it
+    if (hour_tail.block == recent_blocks.size()) return false;
+    ++hour_tail.block;
+    hour_tail.taken = 0;
+  }
+}
+
+static void pop_hour() {
+  last_hour.pop(tier_bucket(hour_tail.front));
+  if (last_hour.size()) next_tail(&hour_tail.front);
+}
+
+// the sample at position taken - 1 of block has just come in
+static void push_hour(const Sample &sample, int block, uint16_t taken) {
+  if (last_hour.size() == HISTORY_RAW_COUNT) pop_hour();
+  if (!last_hour.size()) hour_tail = {sample, block, taken, false, {}};
+  last_hour.push(tier_bucket(sample));
+}
+
+static void trim_hour() {
+  uint32_t start = latest.time >= HOUR_S ? latest.time - HOUR_S + 1 : 0;
+  while (last_hour.size() && hour_tail.front.time < start) pop_hour();
+}
+
+// after a replay, or if the tail's block was ever to leave the recent ones
+static void rebuild_hour() {
+  while (last_hour.size()) last_hour.pop(tier_bucket(hour_tail.front));
+  uint32_t start = latest.time >= HOUR_S ? latest.time - HOUR_S + 1 : 0;
+  SeriesDecoder decoder;
+  for (int block = 0; start_block(&decoder, block); ++block) {
+    Sample sample;
+    for (uint16_t taken = 1; decoder.next(&sample.time, &sample.reading); ++taken) {
+      if (sample.time >= start) push_hour(sample, block, taken);
+    }
+  }
+}
+
+static void trim_all() {
+  trim_hour();
+  trim(ten_minutes, &last_day, DAY_S);
+  trim(hours, &last_week, WEEK_S);
+}
+
+// Replays coarse to fine. Finer records already covered by a closed coarser
+// bucket only fill their own tier; newer ones are cascaded again, which also
+// repairs a bucket that was lost to a power cut between the two appends.
+static void replay_hour(uint8_t type, const uint8_t *payload, uint16_t length, void *context) {
+  if (type != RECORD_BUCKET || length != sizeof(Bucket)) return;
+  Bucket bucket;
+  memcpy(&bucket, payload, sizeof(bucket));
+  tier_push(&hours, &last_week, bucket);
+}
+
+static void replay_ten_minutes(uint8_t type, const uint8_t *payload, uint16_t length, void *context) {
+  // single buckets are from older firmware
+  if ((type != RECORD_BUCKET && type != RECORD_BUCKET_BATCH) || !length || length % sizeof(Bucket)) return;
+  for (uint16_t offset = 0; offset < length; offset += sizeof(Bucket)) {
+    Bucket bucket;
+    memcpy(&bucket, payload + offset, sizeof(bucket));
+    tier_push(&ten_minutes, &last_day, bucket);
+    if (!hours.size() || bucket.time >= hours[hours.size() - 1].time + HOUR_S) add_to_hour(bucket, true);
+  }
+}
+
+static void replay_block(uint8_t type, const uint8_t *payload, uint16_t length, void *context) {
+  SeriesDecoder decoder;
+  if (type != RECORD_SAMPLE_BLOCK || !decoder.start(payload, length)) return;
+  Sample sample;
+  while (decoder.next(&sample.time, &sample.reading)) {
+    latest = sample;
+    if (!ten_minutes.size() || sample.time >= ten_minutes[ten_minutes.size() - 1].time + TEN_MINUTES_S) {
+      add_to_ten_minutes(sample, true);
+    }
+  }
+  recent_blocks.push({payload, length, latest.time});
+}
+
+void history_load() {
+  flash_log_replay(&hourly_log, replay_hour, nullptr);
+  flash_log_replay(&ten_minute_log, replay_ten_minutes, nullptr);
+  flash_log_replay(&raw_log, replay_block, nullptr);
+  rebuild_hour();
+  trim_all();
+}
+
+void history_push(uint32_t time, const Reading &reading) {
+  Sample sample = {};
+  sample.time = time;
+  sample.reading = reading;
+  add_to_block(sample);
+  latest = sample;
+  push_hour(sample, recent_blocks.size(), open_block.count());
+  add_to_ten_minutes(sample, true);
+  trim_all();
+}
+
+uint32_t history_end() {
+  // a bucket only closes once a sample past its end has come in
+  uint32_t end = latest.time ? latest.time + 1 : 0;
+  if (ten_minutes.size() && ten_minutes[ten_minutes.size() - 1].time + TEN_MINUTES_S > end) {
+    end = ten_minutes[ten_minutes.size() - 1].time + TEN_MINUTES_S;
+  }
+  if (hours.size() && hours[hours.size() - 1].time + HOUR_S > end) end = hours[hours.size() - 1].time + HOUR_S;
+  return end;
+}
+
+bool history_latest(uint32_t *time, Reading *reading) {
+  if (!latest.time) return false;
+  *time = latest.time;
+  *reading = latest.reading;
+  return true;
+}
+
+// the hour's points are the raw samples from the tail on, decoded block by block
+
+static void begin_hour(HistoryCursor *cursor) {
+  if (!last_hour.size()) {
+    cursor->block = recent_blocks.size() + 1;
+    return;
+  }
+  cursor->block = hour_tail.block;
+  start_block(&cursor->decoder, cursor->block);
+  Sample skipped;
+  for (uint16_t i = 1; i < hour_tail.taken; ++i) cursor->decoder.next(&skipped.time, &skipped.reading);
+}
+
+static bool next_in_hour(HistoryCursor *cursor, Sample *sample) {
+  if (cursor->block > recent_blocks.size()) return false;
+  do {
+    if (cursor->decoder.next(&sample->time, &sample->reading)) return true;
+  } while (start_block(&cursor->decoder, ++cursor->block));
+  return false;
+}
+
+void history_begin(HistoryCursor *cursor, ChartRange range, Metric metric) {
+  cursor->range = range;
+  cursor->metric = metric;
+  cursor->index = 0;
+  if (range == LastHour) begin_hour(cursor);
+}
+
+int history_count(ChartRange range) {
+  switch (range) {
+    case LastHour: return last_hour.size();
+    case LastDay: return last_day.size() + (open_ten_minutes.count ? 1 : 0);
+    default: return last_week.size() + (open_hour.count ? 1 : 0);
+  }
+}
+
+static HistoryPoint bucket_point(const Bucket &bucket, Metric metric) {
+  return {bucket.time, reading_value(bucket.min, metric), reading_value(bucket.max, metric), reading_value(bucket.mean, metric)};
+}
+
+HistoryPoint history_point(ChartRange range, Metric metric, int index) {
+  switch (range) {
+    case LastHour: {
+      if (index == 0) return bucket_point(tier_bucket(hour_tail.front), metric);
+      if (index == last_hour.size() - 1) return bucket_point(tier_bucket(latest), metric);
+      // walks on from the last point asked for, so going through them in order
+      // decodes each once
+      static HistoryCursor cursor;
+      static uint32_t cursor_latest = 0;
+      HistoryPoint point = {};
+      if (cursor.range != LastHour || cursor.metric != metric || cursor.index > index || cursor_latest != latest.time) {
+        history_begin(&cursor, range, metric);
+        cursor_latest = latest.time;
+      }
+      while (cursor.index <= index && history_next(&cursor, &point)) continue;
+      return point;
+    }
+    case LastDay:
+      if (index < last_day.size()) return bucket_point(ten_minutes[ten_minutes.size() - last_day.size() + index], metric);
+      return bucket_point(open_ten_minutes.bucket(), metric);
+    default:
+      if (index < last_week.size()) return bucket_point(hours[hours.size() - last_week.size() + index], metric);
+      return bucket_point(open_hour.bucket(), metric);
+  }
+}
+
+HistoryPoint history_stats(ChartRange range, Metric metric) {
+  Stats stats;
+  switch (range) {
+    case LastHour:
+      last_hour.add_to(&stats, metric);
+      break;
+    case LastDay:
+      last_day.add_to(&stats, metric);
+      open_ten_minutes.add_to(&stats, metric);
+      break;
+    default:
+      last_week.add_to(&stats, metric);
+      open_hour.add_to(&stats, metric);
+      break;
+  }
+  return stats.point(latest.time);
+}
+
+bool history_next(HistoryCursor *cursor, HistoryPoint *point) {
+  if (cursor->range != LastHour) {
+    if (cursor->index >= history_count(cursor->range)) return false;
+    *point = history_point(cursor->range, cursor->metric, cursor->index++);
+    return true;
+  }
+
+  Sample sample;
+  if (!next_in_hour(cursor, &sample)) return false;
+  *point = bucket_point(tier_bucket(sample), cursor->metric);
+  ++cursor->index;
+  return true;
+}
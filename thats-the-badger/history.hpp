@@ -0,0 +1,72 @@
+#pragma once
+
+#include "state.hpp"
+#include "series.hpp"
+
+// Readings kept at three resolutions: raw samples, 10 minute buckets for a day
+// and hourly buckets for a week. Each bucket keeps min, max and mean per
+// metric. A new sample lands in the open 10 minute bucket; when a bucket
+// closes it is merged into the open hourly one, so a push is O(1) all the way
+// up. Every tier is persisted in its own plain flash log, the raw samples as
+// compressed series blocks that are read back in place for the hour's chart.
+
+// the hour's chart shows at most this many of the newest samples
+#define HISTORY_RAW_COUNT 60
+#define HISTORY_TEN_MINUTE_COUNT 144
+#define HISTORY_HOURLY_COUNT 168
+
+enum Metric : uint8_t {
+    CO2,
+    Temperature,
+    Humidity,
+    METRIC_COUNT
+};
+
+// values are in the Reading's fixed point units
+struct HistoryPoint {
+    uint32_t time;
+    int32_t min;
+    int32_t max;
+    int32_t mean;
+};
+
+int32_t reading_value(const Reading &reading, Metric metric);
+void set_reading_value(Reading *reading, Metric metric, int32_t value);
+
+// fixed point units per display unit, for display only
+int32_t metric_divisor(Metric metric);
+
+// replays the tiers from flash
+void history_load();
+
+// time is in seconds and must not go backwards
+void history_push(uint32_t time, const Reading &reading);
+
+// false if there are no samples yet
+bool history_latest(uint32_t *time, Reading *reading);
+
+// Every sample the history has seen, or summarised, was taken before this, so
+// a clock picking up after the battery was out must not go back before it.
+uint32_t history_end();
+
+// points covering the range, oldest first; the coarser ranges end with the
+// bucket that is still open. The hour's points are decoded as they are asked
+// for, so walking them goes through a cursor.
+int history_count(ChartRange range);
+HistoryPoint history_point(ChartRange range, Metric metric, int index);
+
+struct HistoryCursor {
+  ChartRange range;
+  Metric metric;
+  int index;
+  // for the hour, the block being decoded
+  int block;
+  SeriesDecoder decoder;
+};
+
+void history_begin(HistoryCursor *cursor, ChartRange range, Metric metric);
+bool history_next(HistoryCursor *cursor, HistoryPoint *point);
+
+// min, max and mean over all of the range's points, kept up to date on every
+// push so charts don't have to scan for their axes
+HistoryPoint history_stats(ChartRange range, Metric metric);
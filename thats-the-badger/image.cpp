@@ -0,0 +1,52 @@
+#include <cstring>
+
+#include "display.hpp"
+#include "image.hpp"
+
+// decoded rows waiting to go into the framebuffer as one 8 row block
+static uint8_t strip[8 * DISPLAY_WIDTH / 8];
+
+void draw_image(const RleImage &image, int x, int y) {
+  uint8_t *frame_buffer = badger.frame_buffer();
+  const uint8_t *p = image.data;
+  const uint32_t stride = image.width / 8;
+  const uint32_t size = stride * image.height;
+  if (stride > DISPLAY_WIDTH / 8) return;
+
+  uint32_t strip_start = 0;
+  bool strip_dirty = false;
+  memset(strip, 0, sizeof(strip));
+
+  uint32_t offset = 0;
+  while (offset < size) {
+    uint8_t header = *p++;
+    bool repeat = header & 0x80;
+    uint32_t count = repeat ? (header & 0x7f) + 2 : header + 1;
+    if (repeat && *p == 0x00) {
+      offset += count;
+      ++p;
+      continue;
+    }
+
+    for (uint32_t i = 0; i < count && offset < size; ++i, ++offset) {
+      // a strip goes out once the decoder moves past its last row
+      if (offset - strip_start >= 8 * stride) {
+        if (strip_dirty) {
+          fb_or_rows(frame_buffer, strip, stride, x, y + strip_start / stride, 8);
+          memset(strip, 0, sizeof(strip));
+          strip_dirty = false;
+        }
+        strip_start = offset - offset % (8 * stride);
+      }
+      uint8_t bits = repeat ? *p : p[i];
+      strip[offset - strip_start] = bits;
+      strip_dirty |= bits != 0;
+    }
+    p += repeat ? 1 : count;
+  }
+
+  if (strip_dirty) {
+    uint32_t rows = image.height - strip_start / stride;
+    fb_or_rows(frame_buffer, strip, stride, x, y + strip_start / stride, rows < 8 ? rows : 8);
+  }
+}
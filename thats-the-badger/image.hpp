@@ -0,0 +1,14 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// 1bpp row-major bitmap, 1 for black, packed as generated by tools/rle_image.py
+struct RleImage {
+  uint16_t width;
+  uint16_t height;
+  const uint8_t *data;
+};
+
+// Decodes straight into the framebuffer with its top left corner at x, y.
+// Only black pixels are written, so runs of white cost nothing: clear first.
+void draw_image(const RleImage &image, int x, int y);
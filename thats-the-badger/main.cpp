@@ -1,297 +1,221 @@
-#include <cstdio>
-#include <string>
 #include <cstring>
-#include <sstream>
-#include <iomanip>
-#include <limits>
-#include <array>
 
-#include "badger2040.hpp"
+#include "display.hpp"
 
+#include "cadence.hpp"
+#include "events.hpp"
+#include "governor.hpp"
 #include "sdc4x.hpp"
-
-#include "badge.hpp"
-#include "contact.hpp"
-
-pimoroni::Badger2040 badger;
+#include "history.hpp"
+#include "screens.hpp"
+#include "phases.hpp"
+#include "trace.hpp"
+#include "wake.hpp"
+
+// Raw samples come on the clock whether or not anyone looks, as often as the
+// readings are moving, see cadence.hpp. Phase timings go to flash about
+// hourly, however many wakes that is, and whenever they are looked at.
+#define PHASE_STORE_S (60 * 60)
+// The clock goes to flash about hourly too, rather than a record every wake.
+// After a battery pull the history's end puts a floor under it anyway.
+#define CLOCK_STORE_S (60 * 60)
+// A backstop in case the sensor service neither samples nor gives up. The
+// slowest round, low power periodic, has its first reading 30 s in.
+#define SAMPLE_WAIT_S 120
+
+Badger badger;
 
 State state = State();
 bool state_dirty = false;
-Screen painted_screen = None;
 
 Reading reading = Reading();
 
-std::string to_str(float f) {
-  std::ostringstream os;
-  os << std::fixed << std::setprecision(0) << f;
-  return os.str();
-}
-
-float ctof(float c) {
-  return (c * 9 / 5) + 32;
-}
-
-void wait_for_idle() {
-  if (!badger.is_busy()) return;
-  while (badger.is_busy()) sleep_ms(10);
-}
-
-void draw_badge() {
-  badger.pen(15);
-  badger.clear();
-  badger.image(badge_bitmap);
-}
-
-void draw_contact() {
-  badger.pen(15);
-  badger.clear();
-  badger.image(contact_bitmap);
+// B on the air quality screen steps through the chart ranges
+void show_air_quality() {
+  if (state.current_screen == AirQuality) {
+    state.chart_range = (ChartRange) ((state.chart_range + 1) % (LastWeek + 1));
+  }
+  state.current_screen = AirQuality;
+  state_dirty = true;
 }
 
-void draw_right_text(std::string text, float font_size, int right, int top) {
-  int width = badger.measure_text(text, font_size);
-  badger.pen(0);
-  badger.text(text, right - width, top, font_size);
-}
+// The timer stops in deep sleep, so on every wake we line the time since boot
+// back up with the RTC.
+uint32_t boot_time = 0;
 
-void draw_badge_air_data() {
-  badger.pen(0);
-  badger.font("sans");
-  badger.thickness(2);
-
-  std::string f = to_str(ctof(reading.temperature));
-  badger.pen(15);
-  badger.rectangle(2, 100, 37, 27);
-  draw_right_text(f, 0.7f, 41, 113);
-
-  std::string c = to_str(reading.temperature);
-  badger.pen(15);
-  badger.rectangle(59, 100, 94-59, 27);
-  draw_right_text(c, 0.7f, 96, 113);
-
-  std::string h = to_str(reading.humidity);
-  badger.pen(15);
-  badger.rectangle(116, 100, 157-116, 27);
-  draw_right_text(h, 0.7f, 158 , 113);
-
-  std::string p = to_str(reading.co2);
-  badger.pen(15);
-  badger.rectangle(173, 100, 239-173, 27);
-  draw_right_text(p, 0.7f, 240, 113);
-};
-
-float lerp(float from, float to, float rel) {
-  return ((1 - rel) * from) + (rel * to);
+void sync_clock() {
+  boot_time = clock_now() - to_ms_since_boot(get_absolute_time()) / 1000;
 }
 
-float invlerp(float from, float to, float value) {
-  return (value - from) / (to - from);
+uint32_t clock_s(uint32_t ms_since_boot) {
+  return boot_time + ms_since_boot / 1000;
 }
 
-float remap(float orig_from, float orig_to, float target_from, float target_to, float value){
-  float rel = invlerp(orig_from, orig_to, value);
-  return lerp(target_from, target_to, rel);
-}
+// up dumps the trace over USB, for badges back from the field, and down shows
+// where the wakes spend their time
+#define WAKE_BUTTONS ((1u << badger.A) | (1u << badger.B) | (1u << badger.C) | (1u << badger.UP) | \
+                      (1u << badger.DOWN))
 
-float min(std::array<float, READING_SAMPLE_COUNT> array) {
-  float min = std::numeric_limits<float>().max();
-  for (int i=0; i<READING_SAMPLE_COUNT; ++i) {
-    if (array[i] < min && array[i] != 0) min = array[i];
+void handle_buttons(uint32_t buttons) {
+  if (buttons & (1u << badger.A)) {
+    state.current_screen = Badge;
+    state_dirty = true;
   }
-  return min;
-}
 
-float max(std::array<float, READING_SAMPLE_COUNT> array) {
-  float max = std::numeric_limits<float>().min();
-  for (int i=0; i<READING_SAMPLE_COUNT; ++i) {
-    if (array[i] > max && array[i] != 0) max = array[i];
+  if (buttons & (1u << badger.B)) {
+    show_air_quality();
   }
-  return max;
-}
 
-void draw_line_chart(std::string name, std::string unit, std::array<float, READING_SAMPLE_COUNT> data, int xmin, int xmax, int ymin, int ymax) {
-  float data_min = min(data);
-  float data_max = *std::max_element(data.begin(), data.end());
-
-  badger.font("bitmap4");
-  badger.font("bitmap8");
-  badger.font("bitmap4");
-  badger.thickness(1);
-  draw_right_text(to_str(data_max), 1, 260, ymin);
-  draw_right_text(to_str(data_min), 1, 260, ymax - 4);
-
-  badger.font("bitmap8");
-  badger.thickness(2);
-  draw_right_text(name, 1, 290, ymin);
-
-  badger.font("bitmap16_outline");
-  badger.thickness(1);
-  draw_right_text(to_str(data[READING_SAMPLE_COUNT-1]) + unit, 2, 290, ymin + 10);
-
-  if(data_max == data_min) return;
-
-  printf("min: %f, max: %f\n", data_min, data_max);
-
-  for (int index = 1; index < READING_SAMPLE_COUNT; ++index) {
-    if (data[index - 1] == 0 || data[index] == 0) continue;
-
-    int x0 = remap(0, READING_SAMPLE_COUNT, xmin, xmax, index - 1);
-    int y0 = remap(data_min, data_max, ymax, ymin, data[index - 1]);
-    int x1 = remap(0, READING_SAMPLE_COUNT, xmin, xmax, index);
-    int y1 = remap(data_min, data_max, ymax, ymin, data[index]);
-
-    //printf("(%u, %u) -> (%u, %u)\n", x0, y0, x1, y1);
-
-    badger.line(x0, y0, x1, y1);
+  if (buttons & (1u << badger.C)) {
+    state.current_screen = Contact;
+    state_dirty = true;
   }
-}
 
-void draw_aqm() {
-  badger.pen(15);
-  badger.clear();
-  wait_for_idle();
-
-  badger.pen(0);
-  badger.thickness(1);
-
-  std::array<float, READING_SAMPLE_COUNT> temps;
-  std::array<float, READING_SAMPLE_COUNT> humids;
-  std::array<float, READING_SAMPLE_COUNT> co2s;
-
-  std::transform(state.readings.begin(), state.readings.end(), temps.begin(), [](Reading r) { return r.temperature; });
-  std::transform(state.readings.begin(), state.readings.end(), humids.begin(), [](Reading r) { return r.humidity; });
-  std::transform(state.readings.begin(), state.readings.end(), co2s.begin(), [](Reading r) { return r.co2; });
+  if (buttons & (1u << badger.UP)) {
+    trace_dump();
+  }
 
-  std::rotate(temps.begin(), temps.begin() + state.reading_index + 1, temps.end());
-  std::rotate(humids.begin(), humids.begin() + state.reading_index + 1, humids.end());
-  std::rotate(co2s.begin(), co2s.begin() + state.reading_index + 1, co2s.end());
+  if (buttons & (1u << badger.DOWN)) {
+    state.current_screen = Timings;
+    state_dirty = true;
+    screen_invalidate();
+    phases_store();
+  }
 
-#define CHART_MARGIN 6
-#define SECTION_HEIGHT 42
-  draw_line_chart("TEMP", "°C", temps,2, 225, CHART_MARGIN, SECTION_HEIGHT - 0.5*CHART_MARGIN);
-  draw_line_chart("RH", "%", humids,2, 225, SECTION_HEIGHT + 0.5*CHART_MARGIN,  2*SECTION_HEIGHT - 0.5*CHART_MARGIN);
-  draw_line_chart("CO2", "ppm", co2s,2, 225, 2*SECTION_HEIGHT + 0.5*CHART_MARGIN, 3*SECTION_HEIGHT - CHART_MARGIN);
+  if (buttons & ((1u << badger.A) | (1u << badger.B) | (1u << badger.C) | (1u << badger.DOWN))) {
+    TRACE_INFO(SCREEN, state.current_screen, state.chart_range);
+  }
 }
 
 int main() {
   badger.init();
   stdio_init_all();
-  badger.update_speed(1);
+  battery_init();
   //sleep_ms(1000);
-  printf("init... done.\n");
+  TRACE_INFO(BOOT);
 
-  printf("get_state...\n");
   get_state(&state);
-  printf("get_state {magic: %X, screen: %d, reading_index: %d}\n", state.magic,
-         state.current_screen, state.reading_index);
-  printf("get_state temp %f\n", state.readings[state.reading_index].temperature);
-
-  reading = state.readings[state.reading_index];
-
-  printf("get_state done.\n");
-
-  if (badger.pressed_to_wake(badger.A)) {
-    printf("state.current_screen = Badge...\n");
-    state.current_screen = Badge;
-    state_dirty = true;
-    printf("state.current_screen = Badger done.\n");
-  }
-
-  if (badger.pressed_to_wake(badger.B)) {
-    printf("state.current_screen = AirQuality...\n");
-    state.current_screen = AirQuality;
-    state_dirty = true;
-    printf("state.current_screen = AirQuality done.\n");
-  }
+  // the timer started at reset
+  uint32_t booted_us = phase_begin();
+  phases_load();
+  phase_add(PHASE_BOOT, booted_us);
+  TRACE_INFO(STATE_LOADED, state.current_screen, state.chart_range);
+
+  uint32_t begin = phase_begin();
+  history_load();
+  phase_end(PHASE_HISTORY_LOAD, begin);
+  uint32_t latest_time = 0;
+  history_latest(&latest_time, &reading);
+  TRACE_INFO(HISTORY_LOADED, latest_time, reading.temperature);
+
+  // after a cold boot the best guess is whichever of these is latest
+  uint32_t now = BUILD_EPOCH;
+  if (state.clock > now) now = state.clock;
+  if (history_end() > now) now = history_end();
+  clock_init(now);
+  TRACE_INFO(CLOCK_SET, now, state.clock);
+  uint32_t phases_stored = now;
+
+  begin = phase_begin();
+  init_sensor();
+  phase_end(PHASE_SENSOR_INIT, begin);
 
-  if (badger.pressed_to_wake(badger.C)) {
-    printf("state.current_screen = Contact...\n");
-    state.current_screen = Contact;
-    state_dirty = true;
-    printf("state.current_screen = Contact done.\n");
+  // the button that powered us up is still down, only fresh presses edge
+  uint32_t buttons = 0;
+  for (uint8_t button = 0; button < 32; ++button) {
+    if ((WAKE_BUTTONS & (1u << button)) && badger.pressed_to_wake(button)) buttons |= 1u << button;
+    if (WAKE_BUTTONS & (1u << button)) events_listen_rise(button, EVENT_BUTTONS);
   }
 
-  printf("sensor_init...\n");
-  init_sensor();
-  printf("sensor_init done.\n");
-
   while (true) {
-    printf("main_loop...\n");
-
-    if (badger.pressed(badger.A)) {
-      printf("main_loop state.current_screen = Badge...\n");
-      state.current_screen = Badge;
-      state_dirty = true;
-      printf("main_loop state.current_screen = Badge done.\n");
-    }
-
-    if (badger.pressed(badger.B)) {
-      printf("main_loop state.current_screen = AirQuality...\n");
-      state.current_screen = AirQuality;
-      state_dirty = true;
-      printf("main_loop state.current_screen = AirQuality done.\n");
-    }
-
-    printf("start_air_quality_measurement...\n");
-    if (start_air_quality_measurement() == 0) {
-      printf("start_air_quality_measurement done.\n");
-    } else {
-      printf("start_air_quality_measurement not started.\n");
-    }
-
-    if (state.current_screen == AirQuality && painted_screen != AirQuality) {
-      printf("main_loop draw_aqm...\n");
-      draw_aqm();
-      printf("main_loop draw_aqm done.\n");
-    } else if (state.current_screen == Badge && painted_screen != Badge) {
-      printf("main_loop draw_badge...\n");
-      draw_badge();
-      draw_badge_air_data();
-      printf("main_loop draw_badge done.\n");
-    } else if (state.current_screen == Contact && painted_screen != Contact) {
-      printf("main_loop draw_contact...\n");
-      draw_contact();
-      printf("main_loop draw_contact done.\n");
-    }
-
-    if (painted_screen != state.current_screen) {
-      printf("main_loop update...\n");
-      badger.update();
-      painted_screen = state.current_screen;
-      printf("main_loop update done.\n");
-    }
+    uint32_t awake = phase_begin();
+    sync_clock();
+    TRACE_INFO(WAKE, buttons, clock_now());
+    if (governor_update(clock_now(), &state)) state_dirty = true;
+    const Policy &policy = governor_policy();
+    badger.update_speed(policy.update_speed);
+    handle_buttons(buttons);
+    // from a round that failed while we were finishing the last wake
+    events_take(EVENT_SAMPLE_FAILED);
+    uint32_t interval_ms = cadence_interval() * 1000;
+    sensor_start(interval_ms, policy.sensor_running ? Periodic : sensor_mode_for_interval(interval_ms));
+    uint32_t sensor_wait = phase_begin();
+    absolute_time_t give_up = make_timeout_time_ms(SAMPLE_WAIT_S * 1000);
+
+    // whether anyone is looking, if samples alone don't redraw
+    bool pressed = buttons != 0;
+    bool sampled = false;
+    // without a sample this wake, so sleep until the next interval and try again
+    bool failed = false;
+    while (!sampled && !failed) {
+      uint32_t edges = events_take_edges(WAKE_BUTTONS);
+      if (edges) pressed = true;
+      handle_buttons(edges);
+
+      SensorSample samples[SENSOR_SAMPLE_BATCH];
+      int sample_count = sensor_read_samples(samples, SENSOR_SAMPLE_BATCH);
+      for (int i = 0; i < sample_count; ++i) {
+        history_push(clock_s(samples[i].time), samples[i].reading);
+        cadence_update(clock_s(samples[i].time), samples[i].reading);
+      }
+      if (sample_count) {
+        phase_end(PHASE_SENSOR_WAIT, sensor_wait);
+        reading = samples[sample_count - 1].reading;
+        sampled = true;
+      }
 
-    if (get_air_quality_reading(&reading) == 0) {
-      state.reading_index = (state.reading_index + 1) % READING_SAMPLE_COUNT;
-      memcpy(&state.readings[state.reading_index], &reading, sizeof(Reading));
-      state_dirty = true;
-      if (state.current_screen == Badge) {
-        draw_badge_air_data();
-        badger.partial_update(0, 128-32, 296, 32);
+      begin = phase_begin();
+      if ((policy.refresh_on_sample || pressed) && screen_render(state.current_screen, state, reading)) {
+        phase_end(PHASE_RENDER, begin);
+        TRACE_DEBUG(REFRESH, state.current_screen);
+        display_refresh();
       }
-      if (state.current_screen == AirQuality){
-        draw_aqm();
-        badger.update();
+
+      if (state_dirty) {
+        TRACE_INFO(STORE_STATE, state.current_screen, state.chart_range);
+        begin = phase_begin();
+        store_state(&state);
+        phase_end(PHASE_STORE_STATE, begin);
+        state_dirty = false;
       }
+
+      // nothing to do until a press, a sample or the panel going idle
+      bool refresh_waiting = display_service();
+      if (sampled) continue;
+      uint32_t events = events_wait_until(
+          EVENT_BUTTONS | EVENT_SAMPLE | EVENT_SAMPLE_FAILED | (refresh_waiting ? EVENT_PANEL_IDLE : 0), give_up);
+      if (!events) TRACE_ERROR(SAMPLE_WAIT_TIMEOUT, SAMPLE_WAIT_S);
+      // samples that came with it are taken next wake
+      failed = !events || (events & EVENT_SAMPLE_FAILED);
     }
 
-    if (state_dirty) {
-      printf("main_loop store_state...\n");
-      printf("main_loop store_state {magic: %X, screen: %d, reading_index: %d}\n", state.magic,
-             state.current_screen, state.reading_index);
+    // wake on the next whole interval, so samples stay evenly spaced however
+    // long this wake took
+    uint32_t interval = cadence_interval();
+    uint32_t wake_time = clock_now();
+    wake_time += interval - wake_time % interval;
+    if (wake_time - state.clock >= CLOCK_STORE_S) {
+      state.clock = wake_time;
+      begin = phase_begin();
       store_state(&state);
-      state_dirty = false;
-      printf("main_loop store_state done.\n");
+      phase_end(PHASE_STORE_STATE, begin);
     }
 
-    if (sensor_is_active()) {
-      sleep_ms(50);
-      badger.update_button_states();
+    TRACE_INFO(SLEEP, wake_time);
+    if (policy.sensor_running) {
+      sensor_pause();
     } else {
-      printf("main_loop halt...\n");
-      wait_for_idle();
-      badger.halt();
-      printf("main_loop halt done.\n");
+      sensor_stop();
+    }
+    begin = phase_begin();
+    display_finish();
+    phase_end(PHASE_WAIT_FOR_IDLE, begin);
+
+    phase_end(PHASE_AWAKE, awake);
+    if (wake_time - phases_stored >= PHASE_STORE_S) {
+      phases_store();
+      phases_stored = wake_time;
     }
+    buttons = wake_sleep_until(wake_time, WAKE_BUTTONS);
   }
 }
@@ -0,0 +1,73 @@
+#include <cstring>
+
+#include "pico/stdlib.h"
+
+#include "currents.hpp"
+#include "flash_log.hpp"
+#include "phases.hpp"
+
+#define RECORD_PHASES 1
+
+static FlashLog phase_log = FLASH_LOG(PHASE_LOG_OFFSET, PHASE_LOG_SECTORS, false);
+
+static PhaseStats stats[PHASE_COUNT];
+
+static const char *names[PHASE_COUNT] = {
+  "boot", "history", "sensor init", "sensor wait", "render", "refresh", "store", "idle wait", "awake"
+};
+
+uint32_t phase_begin() {
+  return time_us_32();
+}
+
+void phase_end(Phase phase, uint32_t begin) {
+  phase_add(phase, time_us_32() - begin);
+}
+
+void phase_add(Phase phase, uint32_t us) {
+  PhaseStats &s = stats[phase];
+  if (!s.count || us < s.min_us) s.min_us = us;
+  if (us > s.max_us) s.max_us = us;
+  s.total_us += us;
+  ++s.count;
+}
+
+const PhaseStats &phase_stats(Phase phase) {
+  return stats[phase];
+}
+
+const char *phase_name(Phase phase) {
+  return names[phase];
+}
+
+uint64_t phase_charge(Phase phase) {
+  uint32_t ua = MCU_UA;
+  switch (phase) {
+    case PHASE_SENSOR_INIT:
+    case PHASE_SENSOR_WAIT:
+    // the sensor measures for most of a wake
+    case PHASE_AWAKE:
+      ua += SENSOR_UA;
+      break;
+    case PHASE_REFRESH:
+    case PHASE_WAIT_FOR_IDLE:
+      ua += PANEL_UA;
+      break;
+    default:
+      break;
+  }
+  return stats[phase].total_us * ua;
+}
+
+// the newest snapshot wins
+static void replay_phases(uint8_t type, const uint8_t *payload, uint16_t length, void *context) {
+  if (type == RECORD_PHASES && length == sizeof(stats)) memcpy(stats, payload, sizeof(stats));
+}
+
+void phases_load() {
+  flash_log_replay(&phase_log, replay_phases, nullptr);
+}
+
+void phases_store() {
+  flash_log_append(&phase_log, RECORD_PHASES, stats, sizeof(stats));
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// Where a wake spends its time, and so roughly its charge. Each phase keeps a
+// count, min, max and total duration in RAM, which survives deep sleep, and
+// the lot is persisted now and then so it also outlives a flat battery.
+
+enum Phase : uint8_t {
+    // reset until the state is loaded, once per power-up
+    PHASE_BOOT,
+    PHASE_HISTORY_LOAD,
+    PHASE_SENSOR_INIT,
+    // sensor_start until the first sample reaches the main loop
+    PHASE_SENSOR_WAIT,
+    // drawing a screen into the framebuffer
+    PHASE_RENDER,
+    // diffing and sending the framebuffer, the panel then runs by itself
+    PHASE_REFRESH,
+    PHASE_STORE_STATE,
+    // the panel finishing its last refresh before we can sleep
+    PHASE_WAIT_FOR_IDLE,
+    // a whole wake, from waking to going back to sleep
+    PHASE_AWAKE,
+    PHASE_COUNT
+};
+
+struct PhaseStats {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+};
+
+// us timestamp to hand to phase_end
+uint32_t phase_begin();
+void phase_end(Phase phase, uint32_t begin);
+// for a phase timed some other way
+void phase_add(Phase phase, uint32_t us);
+
+const PhaseStats &phase_stats(Phase phase);
+const char *phase_name(Phase phase);
+
+// Estimated charge in uA*us, from the time spent and the nominal current of
+// whatever is powered during the phase. Phases nest: the awake phase covers
+// everything after start-up.
+uint64_t phase_charge(Phase phase);
+
+// replaces whatever has been counted so far
+void phases_load();
+void phases_store();
@@ -0,0 +1,386 @@
+#include "display.hpp"
+#include "screens.hpp"
+
+#include "history.hpp"
+#include "short_text.hpp"
+#include "glyph_atlas.hpp"
+#include "phases.hpp"
+#include "trace.hpp"
+
+#include "image.hpp"
+#include "badge_image.hpp"
+#include "contact_image.hpp"
+
+#define MAX_WIDGETS 8
+
+// A new reading only replaces the one on screen once it has moved this far
+// from it, in the Reading's units, so noise across a rounding boundary doesn't
+// flip the text back and forth, a refresh each time.
+#define CO2_HYSTERESIS 5
+#define TEMPERATURE_HYSTERESIS 20
+#define HUMIDITY_HYSTERESIS 50
+
+// A rectangle of the screen that only its widget draws in. Widgets are drawn in
+// list order, so a later one may cover part of an earlier one, like the
+// readings over the badge artwork, and then owns that part.
+struct Widget {
+  int16_t x, y, w, h;
+  // whatever the widget shows folded into one word, it is drawn again when
+  // this changes
+  uint32_t (*inputs)(const Widget &widget, const State &state, const Reading &reading);
+  // draws inside the bounds, which are white to start with
+  void (*draw)(const Widget &widget, const State &state, const Reading &reading);
+  // what the functions above need to know about this one, by kind of widget
+  const void *spec;
+};
+
+struct Layout {
+  const Widget *widgets;
+  int count;
+};
+
+template <int N>
+constexpr Layout layout(const Widget (&widgets)[N]) {
+  static_assert(N <= MAX_WIDGETS, "a screen has more widgets than screen_render keeps track of");
+  return {widgets, N};
+}
+
+static uint32_t mix(uint32_t hash, uint32_t value) {
+  return (hash ^ value) * 16777619;
+}
+
+// widgets that show text are drawn again when the text changes, not the value
+static uint32_t mix_text(uint32_t hash, const char *text) {
+  while (*text) hash = mix(hash, (uint8_t) *text++);
+  return hash;
+}
+
+static uint32_t constant_inputs(const Widget &widget, const State &state, const Reading &reading) {
+  return 0;
+}
+
+ShortText format_metric(Metric metric, int32_t value) {
+  return format_ratio(value, metric_divisor(metric));
+}
+
+// from hundredths of a degree C, F = C * 9 / 5 + 32
+ShortText format_fahrenheit(int32_t centi_c) {
+  return format_ratio(centi_c * 9 + 16000, 500);
+}
+
+void draw_right_text(Face face, const char *text, int right, int top) {
+  atlas_text(face, text, right - atlas_measure(face, text), top);
+}
+
+// images, spec is the RleImage
+
+static void draw_image_widget(const Widget &widget, const State &state, const Reading &reading) {
+  draw_image(*(const RleImage *) widget.spec, widget.x, widget.y);
+}
+
+// readings along the bottom of the badge
+
+struct ReadingLabel {
+  Metric metric;
+  bool fahrenheit;
+  // where the text ends, the widget's right edge, so a redraw clears all of it
+  int16_t right;
+  int16_t top;
+};
+
+static ShortText reading_text(const ReadingLabel &label, const Reading &reading) {
+  int32_t value = reading_value(reading, label.metric);
+  return label.fahrenheit ? format_fahrenheit(value) : format_metric(label.metric, value);
+}
+
+static uint32_t reading_inputs(const Widget &widget, const State &state, const Reading &reading) {
+  return mix_text(2166136261, reading_text(*(const ReadingLabel *) widget.spec, reading).c_str());
+}
+
+static void draw_reading(const Widget &widget, const State &state, const Reading &reading) {
+  const ReadingLabel &label = *(const ReadingLabel *) widget.spec;
+  draw_right_text(FACE_BADGE_READING, reading_text(label, reading).c_str(), label.right, label.top);
+}
+
+// charts of the history, with their limits, name and the latest value
+
+float lerp(float from, float to, float rel) {
+  return ((1 - rel) * from) + (rel * to);
+}
+
+float invlerp(float from, float to, float value) {
+  return (value - from) / (to - from);
+}
+
+float remap(float orig_from, float orig_to, float target_from, float target_to, float value){
+  float rel = invlerp(orig_from, orig_to, value);
+  return lerp(target_from, target_to, rel);
+}
+
+struct Chart {
+  const char *name;
+  const char *unit;
+  Metric metric;
+  int16_t ymin;
+  int16_t ymax;
+};
+
+#define CHART_XMIN 2
+#define CHART_XMAX 225
+
+// Points that land in the same pixel column collapse into one stroke over
+// everything they span, their own min and max included, joined to the columns
+// either side through the first and last mean. However long the history, a
+// chart draws at most two lines a column, and a spike still reaches its pixel.
+struct ChartColumn {
+  int x;
+  int32_t first;
+  int32_t last;
+  int32_t low;
+  int32_t high;
+};
+
+struct ChartPen {
+  int32_t data_min, data_max;
+  int ymin, ymax;
+  bool joined;
+  int x, y;
+
+  int to_y(int32_t value) const {
+    return remap(data_min, data_max, ymax, ymin, value);
+  }
+
+  void draw(const ChartColumn &column) {
+    if (column.high != column.low) badger.line(column.x, to_y(column.low), column.x, to_y(column.high));
+    if (joined) badger.line(x, y, column.x, to_y(column.first));
+    joined = true;
+    x = column.x;
+    y = to_y(column.last);
+  }
+};
+
+void draw_line_chart(const char *name, const char *unit, ChartRange range, Metric metric, int32_t latest, int xmin, int xmax, int ymin, int ymax) {
+  int count = history_count(range);
+
+  HistoryPoint stats = history_stats(range, metric);
+  int32_t data_min = stats.min, data_max = stats.max;
+
+  draw_right_text(FACE_CHART_AXIS, format_metric(metric, data_max).c_str(), 260, ymin);
+  draw_right_text(FACE_CHART_AXIS, format_metric(metric, data_min).c_str(), 260, ymax - 4);
+
+  draw_right_text(FACE_CHART_NAME, name, 290, ymin);
+
+  ShortText current = format_metric(metric, latest);
+  current += unit;
+  draw_right_text(FACE_CHART_VALUE, current.c_str(), 290, ymin + 10);
+
+  if (count < 2 || data_max == data_min) return;
+
+  TRACE_DEBUG(CHART_LIMITS, data_min, data_max);
+
+  // x is time, so gaps while the badge was off show up as straight runs
+  uint32_t start = history_point(range, metric, 0).time;
+  uint32_t end = history_point(range, metric, count - 1).time;
+  if (end == start) return;
+
+  badger.pen(0);
+  badger.thickness(1);
+  ChartPen pen = {data_min, data_max, ymin, ymax, false, 0, 0};
+  ChartColumn column = {};
+  HistoryCursor cursor;
+  HistoryPoint point;
+  history_begin(&cursor, range, metric);
+  for (int index = 0; history_next(&cursor, &point); ++index) {
+    int x = remap(start, end, xmin, xmax, point.time);
+    if (index > 0 && x == column.x) {
+      // buckets also show their spread
+      column.last = point.mean;
+      if (point.min < column.low) column.low = point.min;
+      if (point.max > column.high) column.high = point.max;
+      continue;
+    }
+    if (index > 0) pen.draw(column);
+    column = {x, point.mean, point.mean, point.min, point.max};
+  }
+  pen.draw(column);
+}
+
+// every push moves the latest time, and with it the range's points
+static uint32_t chart_inputs(const Widget &widget, const State &state, const Reading &reading) {
+  const Chart &chart = *(const Chart *) widget.spec;
+  uint32_t latest_time = 0;
+  Reading latest;
+  history_latest(&latest_time, &latest);
+  uint32_t hash = mix(2166136261, state.chart_range);
+  hash = mix(hash, latest_time);
+  return mix_text(hash, format_metric(chart.metric, reading_value(reading, chart.metric)).c_str());
+}
+
+static void draw_chart(const Widget &widget, const State &state, const Reading &reading) {
+  const Chart &chart = *(const Chart *) widget.spec;
+  draw_line_chart(chart.name, chart.unit, state.chart_range, chart.metric, reading_value(reading, chart.metric),
+                  CHART_XMIN, CHART_XMAX, chart.ymin, chart.ymax);
+}
+
+const char *range_label(ChartRange range) {
+  switch (range) {
+    case LastHour: return "1H";
+    case LastDay: return "1D";
+    default: return "1W";
+  }
+}
+
+static uint32_t range_inputs(const Widget &widget, const State &state, const Reading &reading) {
+  return state.chart_range;
+}
+
+static void draw_range(const Widget &widget, const State &state, const Reading &reading) {
+  draw_right_text(FACE_CHART_RANGE, range_label(state.chart_range), widget.x + widget.w - 6, widget.y + 6);
+}
+
+// phase timings, drawn as they stand when the screen comes up
+
+// tenths, for the timings, which are never negative
+ShortText format_tenths(uint32_t tenths) {
+  ShortText text = format_int(tenths / 10);
+  text.append('.');
+  text.append((char) ('0' + tenths % 10));
+  return text;
+}
+
+#define STATS_ROW_HEIGHT 12
+
+static void draw_timings(const Widget &widget, const State &state, const Reading &reading) {
+  badger.pen(0);
+  badger.thickness(1);
+
+  atlas_text(FACE_TIMINGS, "phase", 2, 2);
+  draw_right_text(FACE_TIMINGS, "count", 110, 2);
+  draw_right_text(FACE_TIMINGS, "min ms", 156, 2);
+  draw_right_text(FACE_TIMINGS, "mean", 202, 2);
+  draw_right_text(FACE_TIMINGS, "max", 248, 2);
+  draw_right_text(FACE_TIMINGS, "uAh", 294, 2);
+
+  for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+    const PhaseStats &stats = phase_stats((Phase) phase);
+    int top = 2 + (phase + 1) * STATS_ROW_HEIGHT;
+    atlas_text(FACE_TIMINGS, phase_name((Phase) phase), 2, top);
+    draw_right_text(FACE_TIMINGS, format_int(stats.count).c_str(), 110, top);
+    if (!stats.count) continue;
+
+    // charge per occurrence, in tenths of a uAh
+    uint64_t charge = phase_charge((Phase) phase) / stats.count / 360000000;
+    draw_right_text(FACE_TIMINGS, format_tenths(stats.min_us / 100).c_str(), 156, top);
+    draw_right_text(FACE_TIMINGS, format_tenths(stats.total_us / stats.count / 100).c_str(), 202, top);
+    draw_right_text(FACE_TIMINGS, format_tenths(stats.max_us / 100).c_str(), 248, top);
+    draw_right_text(FACE_TIMINGS, format_tenths(charge).c_str(), 294, top);
+  }
+}
+
+// the screens
+
+// each reading ends where the artwork's unit begins
+static const ReadingLabel fahrenheit_label = {Temperature, true, 40, 113};
+static const ReadingLabel celsius_label = {Temperature, false, 95, 113};
+static const ReadingLabel humidity_label = {Humidity, false, 158, 113};
+static const ReadingLabel co2_label = {CO2, false, 240, 113};
+
+static const Widget badge_widgets[] = {
+  {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, constant_inputs, draw_image_widget, &badge_image},
+  {2, 100, 38, 27, reading_inputs, draw_reading, &fahrenheit_label},
+  {59, 100, 36, 27, reading_inputs, draw_reading, &celsius_label},
+  {116, 100, 42, 27, reading_inputs, draw_reading, &humidity_label},
+  {173, 100, 67, 27, reading_inputs, draw_reading, &co2_label},
+};
+
+static const Widget contact_widgets[] = {
+  {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, constant_inputs, draw_image_widget, &contact_image},
+};
+
+// each chart keeps its text inside a third of the screen
+static const Chart temperature_chart = {"TEMP", "°C", Temperature, 6, 39};
+static const Chart humidity_chart = {"RH", "%", Humidity, 45, 81};
+static const Chart co2_chart = {"CO2", "ppm", CO2, 87, 120};
+
+static const Widget air_quality_widgets[] = {
+  {0, 0, DISPLAY_WIDTH, 44, chart_inputs, draw_chart, &temperature_chart},
+  {0, 44, DISPLAY_WIDTH, 42, chart_inputs, draw_chart, &humidity_chart},
+  {0, 86, DISPLAY_WIDTH, 42, chart_inputs, draw_chart, &co2_chart},
+  // in the corner the co2 chart leaves free
+  {262, 112, 34, 16, range_inputs, draw_range, nullptr},
+};
+
+static const Widget timings_widgets[] = {
+  {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, constant_inputs, draw_timings, nullptr},
+};
+
+// by Screen
+static const Layout layouts[] = {
+  {nullptr, 0},
+  layout(badge_widgets),
+  layout(air_quality_widgets),
+  layout(contact_widgets),
+  layout(timings_widgets),
+};
+
+static Screen drawn_screen = None;
+static uint32_t drawn_inputs[MAX_WIDGETS];
+
+static const int32_t hysteresis[METRIC_COUNT] = {CO2_HYSTERESIS, TEMPERATURE_HYSTERESIS, HUMIDITY_HYSTERESIS};
+static Reading shown;
+static bool shown_valid = false;
+
+// the reading the screens show, which only follows the sensor's once it moves
+// by more than the metric's hysteresis
+static const Reading &shown_reading(const Reading &reading) {
+  for (int m = 0; m < METRIC_COUNT; ++m) {
+    int32_t value = reading_value(reading, (Metric) m);
+    int32_t change = value - reading_value(shown, (Metric) m);
+    if (!shown_valid || change >= hysteresis[m] || change <= -hysteresis[m]) set_reading_value(&shown, (Metric) m, value);
+  }
+  shown_valid = true;
+  return shown;
+}
+
+static bool overlaps(const Widget &a, const Widget &b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+bool screen_render(Screen screen, const State &state, const Reading &sensed) {
+  const Reading &reading = shown_reading(sensed);
+  const Layout &layout = layouts[screen];
+  bool whole = screen != drawn_screen;
+  if (whole) {
+    TRACE_DEBUG(DRAW, screen);
+    fb_clear(badger.frame_buffer(), false);
+    display_damage(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    drawn_screen = screen;
+  }
+
+  bool drawn[MAX_WIDGETS] = {};
+  bool any = whole;
+  for (int index = 0; index < layout.count; ++index) {
+    const Widget &widget = layout.widgets[index];
+    uint32_t inputs = widget.inputs(widget, state, reading);
+    drawn[index] = whole || inputs != drawn_inputs[index];
+    // whatever was drawn underneath may have gone over this one
+    for (int below = 0; below < index && !drawn[index]; ++below) {
+      drawn[index] = drawn[below] && overlaps(layout.widgets[below], widget);
+    }
+    if (!drawn[index]) continue;
+
+    if (!whole) {
+      TRACE_DEBUG(DRAW_WIDGET, screen, index);
+      fb_fill_rect(badger.frame_buffer(), widget.x, widget.y, widget.w, widget.h, false);
+      display_damage(widget.x, widget.y, widget.w, widget.h);
+    }
+    widget.draw(widget, state, reading);
+    drawn_inputs[index] = inputs;
+    any = true;
+  }
+  return any;
+}
+
+void screen_invalidate() {
+  drawn_screen = None;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "state.hpp"
+
+// What each screen shows, as a list of widgets: a rectangle of the screen,
+// drawn by one function from a few fields of the state and the latest reading.
+// Rendering a screen draws only the widgets whose inputs changed since they
+// were last drawn, and hands their bounds to display_damage, so static content
+// like the badge artwork is drawn once when the screen comes up and the
+// refresh only looks at what may have changed. The framebuffer survives deep
+// sleep, and so does what the widgets last drew.
+//
+// Readings are compared as the text they show, and a new one only replaces
+// what is on screen once it moves by more than a per-metric hysteresis, so a
+// reading that changes nothing visible draws nothing and costs no refresh.
+
+// Draws whatever changed into the framebuffer, false if nothing did.
+bool screen_render(Screen screen, const State &state, const Reading &reading);
+
+// the next render draws the whole screen, for when what it shows changed in a
+// way its widgets can't see
+void screen_invalidate();
@@ -1,128 +1,483 @@
-#include <stdio.h>
-
 #include "sdc4x.hpp"
-#include "scd4x_i2c.h"
 #include "pimoroni_i2c.hpp"
-#include "sensirion_i2c_hal.h"
-#include "pico/multicore.h"
-#include "pico/util/queue.h"
+#include "hardware/i2c.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "events.hpp"
+#include "spsc_ring.hpp"
+#include "trace.hpp"
+
+// SCD41 datasheet figures at 3.3 V
+#define PERIODIC_INTERVAL_MS 5000
+#define LOW_POWER_INTERVAL_MS 30000
+#define SINGLE_SHOT_MS 5000
+#define PERIODIC_UA 15000
+#define LOW_POWER_UA 3200
+#define IDLE_UA 200
+
+#define SCD4X_ADDRESS 0x62
+
+#define POLL_US 500000
+#define SERVICE_IDLE_MS 50
+// how soon a kick from the main loop gets the service going
+#define KICK_US 10
+
+// the longest transfer is 9 bytes, about 250 us at 400 kHz
+#define I2C_TIMEOUT_US 2000
+// a failed command goes out again after 10, 20 and 40 ms before we give up
+#define COMMAND_ATTEMPTS 4
+#define BACKOFF_US 10000
+// data that isn't ready this long after it was due isn't coming
+#define READY_TIMEOUT_US 2000000
+// a sample that fails is taken again after a backoff, this many times over
+#define SAMPLE_ATTEMPTS 3
+// I2C errors are the SDK's, all negative
+#define ERROR_CRC 1
+
+enum CommandType : uint8_t {
+  WakeUp,
+  Start,
+  Stop,
+  Pause,
+  SetInterval,
+  Recalibrate
+};
+
+struct SensorCommand {
+  CommandType type;
+  SensorMode mode;
+  uint16_t co2_ppm;
+  uint32_t interval_ms;
+};
 
-#define MINIMUM_GAP_MS (30 * 1000);
+struct Scd4xCommand {
+  uint16_t code;
+  bool has_argument;
+  // the sensor takes no other transfer until this is up
+  uint32_t execution_us;
+  // words to read back once it has executed, each followed by its CRC
+  uint8_t response_words;
+};
+
+// datasheet section 3.5 onwards
+static const Scd4xCommand START_PERIODIC_MEASUREMENT = {0x21b1, false, 0, 0};
+static const Scd4xCommand START_LOW_POWER_PERIODIC_MEASUREMENT = {0x21ac, false, 0, 0};
+static const Scd4xCommand STOP_PERIODIC_MEASUREMENT = {0x3f86, false, 500000, 0};
+static const Scd4xCommand MEASURE_SINGLE_SHOT = {0x219d, false, 5000000, 0};
+static const Scd4xCommand GET_DATA_READY_STATUS = {0xe4b8, false, 1000, 1};
+static const Scd4xCommand READ_MEASUREMENT = {0xec05, false, 1000, 3};
+static const Scd4xCommand PERFORM_FORCED_RECALIBRATION = {0x362f, true, 400000, 1};
+// never acknowledged
+static const Scd4xCommand WAKE_UP = {0x36f6, false, 20000, 0};
+
+// what the service is doing until its deadline
+enum Step : uint8_t {
+  // nothing at all until the main loop sends a command
+  Resting,
+  // the next sample is due
+  Waiting,
+  // a command is executing on the sensor
+  Executing,
+  // a command failed and goes out again
+  BackingOff,
+  // the sensor is measuring, poll for its data
+  Measuring
+};
+
+// runs once a command has executed, with its response
+typedef void (*Continuation)(const uint16_t *response);
 
 pimoroni::I2C i2c(pimoroni::BOARD::BREAKOUT_GARDEN);
 
-queue_t results_queue;
-uint32_t last_time = 0;
-bool sensor_active = false;
+// the main loop to the service and back
+static SpscRing<SensorCommand, 8> commands;
+static SpscRing<SensorSample, SENSOR_SAMPLE_BATCH> samples;
+
+static int sensor_alarm = -1;
+
+// everything below is only touched by the service, from the alarm interrupt
+static Step step = Resting;
+static absolute_time_t deadline;
+
+static const Scd4xCommand *in_flight = nullptr;
+static uint16_t in_flight_argument = 0;
+static Continuation then = nullptr;
+static uint8_t attempt = 0;
+
+static bool sampling = false;
+static SensorMode service_mode = SingleShot;
+static uint32_t service_interval_ms = 0;
+static absolute_time_t next_sample;
+static bool sample_pending = false;
+static uint8_t failed_samples = 0;
+static absolute_time_t data_due;
+static uint16_t recalibration_ppm = 0;
+
+// what the sensor is doing between samples
+static bool running = false;
+static SensorMode running_mode = SingleShot;
+
+static uint32_t mode_interval_ms(SensorMode mode) {
+  switch (mode) {
+    case Periodic: return PERIODIC_INTERVAL_MS;
+    case LowPowerPeriodic: return LOW_POWER_INTERVAL_MS;
+    default: return SINGLE_SHOT_MS;
+  }
+}
+
+// Charge per interval in uA*ms. The periodic modes can't skip samples, so they
+// draw their average current the whole time; a single shot measures at about
+// periodic current and idles until the next one.
+static uint64_t mode_charge(SensorMode mode, uint32_t interval_ms) {
+  switch (mode) {
+    case Periodic: return (uint64_t) PERIODIC_UA * interval_ms;
+    case LowPowerPeriodic: return (uint64_t) LOW_POWER_UA * interval_ms;
+    default: return (uint64_t) PERIODIC_UA * SINGLE_SHOT_MS + (uint64_t) IDLE_UA * (interval_ms - SINGLE_SHOT_MS);
+  }
+}
+
+SensorMode sensor_mode_for_interval(uint32_t interval_ms) {
+  SensorMode best = Periodic;
+  for (int mode = LowPowerPeriodic; mode <= SingleShot; ++mode) {
+    if (interval_ms < mode_interval_ms((SensorMode) mode)) continue;
+    if (mode_charge((SensorMode) mode, interval_ms) < mode_charge(best, interval_ms)) best = (SensorMode) mode;
+  }
+  return best;
+}
 
 uint32_t time() {
   absolute_time_t t = get_absolute_time();
   return to_ms_since_boot(t);
 }
 
-void init_sensor() {
-  printf("sensor_init hal...\n");
-  sensirion_i2c_hal_init(&i2c);
-  printf("sensor_init wake...\n");
-  scd4x_wake_up();
-  //printf("sensor_init stop...\n");
-  //scd4x_stop_periodic_measurement();
-  //printf("sensor_init reinit...\n");
-  //scd4x_reinit();
-  printf("sensor_init queue...\n");
-  queue_init(&results_queue, sizeof(Reading), 2);
-}
-
-void air_quality_worker() {
-  int16_t error;
-
-  printf("air_quality_worker...:\n");
-
-  error = scd4x_start_periodic_measurement();
-  if (error) {
-    printf("air_quality_worker error calling scd4x_start_periodic_measurement.\n");
+// CRC-8, polynomial 0x31 from 0xff, over every argument and response word
+static uint8_t crc8(const uint8_t *data, int count) {
+  uint8_t crc = 0xff;
+  for (int i = 0; i < count; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) crc = crc & 0x80 ? (crc << 1) ^ 0x31 : crc << 1;
   }
+  return crc;
+}
 
-  printf("air_quality_worker waiting for data...\n");
-  uint16_t _co2;
-  int32_t _temperature;
-  int32_t _humidity;
-  while (true) {
-    sensirion_i2c_hal_sleep_usec(5000000);
-    uint16_t data_ready = 0;
-    error = scd4x_get_data_ready_status(&data_ready);
-    if (error) {
-      printf("air_quality_worker error calling scd4x_get_data_ready_status.\n");
-      break;
-    }
+// Transfers are a few bytes and done well inside the timeout, so they go out
+// directly; only the execution times in between are waited out on the alarm.
+static int write_command() {
+  uint8_t bytes[5] = {(uint8_t) (in_flight->code >> 8), (uint8_t) in_flight->code};
+  int length = 2;
+  if (in_flight->has_argument) {
+    bytes[2] = in_flight_argument >> 8;
+    bytes[3] = in_flight_argument;
+    bytes[4] = crc8(bytes + 2, 2);
+    length = 5;
+  }
+  int result = i2c_write_timeout_us(i2c.get_i2c(), SCD4X_ADDRESS, bytes, length, false, I2C_TIMEOUT_US);
+  if (result == length) return 0;
+  return result < 0 ? result : PICO_ERROR_GENERIC;
+}
 
-    if (!(data_ready & 0x7ff)) {
-      printf(".");
-      continue;
-    }
+static int read_response(uint16_t *words) {
+  uint8_t bytes[9];
+  int length = in_flight->response_words * 3;
+  int result = i2c_read_timeout_us(i2c.get_i2c(), SCD4X_ADDRESS, bytes, length, false, I2C_TIMEOUT_US);
+  if (result != length) return result < 0 ? result : PICO_ERROR_GENERIC;
 
-    error = scd4x_read_measurement(&_co2, &_temperature, &_humidity);
-    if (error) {
-      printf("air_quality_worker error calling scd4x_get_data_ready_status.\n");
-      continue;
-    }
-    if (_co2 == 0) {
-      printf("air_quality_worker: invalid sample.\n");
-      continue;
-    }
+  for (int i = 0; i < in_flight->response_words; ++i) {
+    const uint8_t *word = bytes + i * 3;
+    if (crc8(word, 2) != word[2]) return ERROR_CRC;
+    words[i] = word[0] << 8 | word[1];
+  }
+  return 0;
+}
 
-    error = scd4x_stop_periodic_measurement();
-    if (error) {
-      printf("air_quality_worker error calling scd4x_stop_periodic_measurement.\n");
-    }
+static void wait_us(Step next, uint64_t us) {
+  step = next;
+  deadline = make_timeout_time_us(us);
+}
+
+static void rest();
 
-    break;
+static void sample_failed() {
+  if (!sample_pending) return;
+  sample_pending = false;
+  if (++failed_samples < SAMPLE_ATTEMPTS) {
+    next_sample = make_timeout_time_us(BACKOFF_US);
+  } else {
+    // the next round is on the interval as usual, but the main loop needn't wait
+    failed_samples = 0;
+    TRACE_ERROR(SENSOR_SAMPLE_FAILED, SAMPLE_ATTEMPTS);
+    events_post(EVENT_SAMPLE_FAILED);
   }
+}
+
+// gives up on whatever the failed command was for
+static void fail(int error) {
+  const Scd4xCommand *command = in_flight;
+  in_flight = nullptr;
 
-  Reading reading;
+  if (command == &STOP_PERIODIC_MEASUREMENT) {
+    TRACE_ERROR(SENSOR_STOP_FAILED, error);
+  } else if (command == &GET_DATA_READY_STATUS) {
+    TRACE_ERROR(SENSOR_READY_FAILED, error);
+  } else if (command == &READ_MEASUREMENT) {
+    TRACE_ERROR(SENSOR_READ_FAILED, error);
+  } else if (command == &PERFORM_FORCED_RECALIBRATION) {
+    TRACE_ERROR(SENSOR_RECALIBRATION_FAILED, recalibration_ppm);
+  } else {
+    TRACE_ERROR(SENSOR_START_FAILED, service_mode, error);
+  }
 
-  reading.co2 = _co2;
-  printf("air_quality_worker CO2: %.2fuppm\n", reading.co2);
+  sample_failed();
+  recalibration_ppm = 0;
+  rest();
+}
 
-  reading.temperature = _temperature / 1000.0f;
-  printf("air_quality_worker Temperature: %.2f°C\n", reading.temperature);
+static void retry(int error) {
+  if (++attempt == COMMAND_ATTEMPTS) return fail(error);
+  TRACE_DEBUG(SENSOR_RETRY, in_flight->code, error);
+  wait_us(BackingOff, (uint64_t) BACKOFF_US << (attempt - 1));
+}
+
+static void send_in_flight() {
+  int error = write_command();
+  if (error && in_flight != &WAKE_UP) return retry(error);
+  wait_us(Executing, in_flight->execution_us);
+}
 
-  reading.humidity = _humidity / 1000.0f;
-  printf("air_quality_worker Humidity: %.2f%%\n", reading.humidity);
+static void issue(const Scd4xCommand &command, uint16_t argument, Continuation next) {
+  in_flight = &command;
+  in_flight_argument = argument;
+  then = next;
+  attempt = 0;
+  send_in_flight();
+}
 
-  for (int tries=10; tries>0; --tries) {
-    if (queue_try_add(&results_queue, &reading)) break;
-    sleep_ms(100 * tries);
+static void complete() {
+  uint16_t response[3] = {};
+  if (in_flight->response_words) {
+    int error = read_response(response);
+    if (error) return retry(error);
   }
-  sensor_active = false;
-}
-
-int start_air_quality_measurement() {
-  // only start a measurement if a sensible amount of time has elapsed
-  uint32_t now = time();
-  if (now - last_time > (10 * 1000) || last_time == 0) {
-    printf("start_air_quality_measurement starting air_quality_worker on core1...\n");
-    multicore_reset_core1();
-    multicore_launch_core1(air_quality_worker);
-    sensor_active = true;
-    last_time = now;
-    printf("start_air_quality_measurement starting air_quality_worker on core1 done.\n");
-    return 0;
+  in_flight = nullptr;
+  then(response);
+}
+
+static void start_measurement();
+
+static void woken(const uint16_t *) {
+  rest();
+}
+
+static void stopped(const uint16_t *) {
+  running = false;
+  if (sample_pending) return start_measurement();
+  rest();
+}
+
+static void recalibrated(const uint16_t *response) {
+  if (response[0] == 0xffff) {
+    TRACE_ERROR(SENSOR_RECALIBRATION_FAILED, recalibration_ppm);
+  } else {
+    TRACE_INFO(SENSOR_RECALIBRATED, recalibration_ppm, response[0] - 0x8000);
+  }
+  recalibration_ppm = 0;
+  rest();
+}
+
+// needs a few minutes of periodic measurement at the reference beforehand
+static void recalibrate() {
+  if (running) return issue(STOP_PERIODIC_MEASUREMENT, 0, stopped);
+  issue(PERFORM_FORCED_RECALIBRATION, recalibration_ppm, recalibrated);
+}
+
+// between commands: recalibrate if asked to, otherwise wait for the next sample
+static void rest() {
+  if (recalibration_ppm) return recalibrate();
+  step = sampling ? Waiting : Resting;
+  deadline = next_sample;
+}
+
+static void measurement_read(const uint16_t *response) {
+  if (response[0] == 0) {
+    TRACE_ERROR(SENSOR_INVALID_SAMPLE);
+    sample_failed();
+    return rest();
+  }
+  sample_pending = false;
+  failed_samples = 0;
+
+  SensorSample sample;
+  sample.time = time();
+  sample.reading.co2 = response[0];
+  // the driver's fixed point conversions to thousandths, and we keep hundredths
+  sample.reading.temperature = (((21875 * (int32_t) response[1]) >> 13) - 45000) / 10;
+  sample.reading.humidity = ((12500 * (int32_t) response[2]) >> 13) / 10;
+  TRACE_INFO(SENSOR_READING, sample.reading.co2, sample.reading.temperature);
+  TRACE_INFO(SENSOR_HUMIDITY, sample.reading.humidity);
+  if (!samples.push_or_drop(sample)) TRACE_ERROR(SENSOR_SAMPLE_DROPPED, samples.dropped());
+  events_post(EVENT_SAMPLE);
+  rest();
+}
+
+static void data_ready(const uint16_t *response) {
+  if (response[0] & 0x7ff) return issue(READ_MEASUREMENT, 0, measurement_read);
+
+  if (absolute_time_diff_us(data_due, get_absolute_time()) > READY_TIMEOUT_US) {
+    TRACE_ERROR(SENSOR_READY_TIMEOUT, READY_TIMEOUT_US / 1000);
+    sample_failed();
+    return rest();
+  }
+  TRACE_DEBUG(SENSOR_NOT_READY);
+  wait_us(Measuring, POLL_US);
+}
+
+static void wait_for_data(uint64_t us) {
+  wait_us(Measuring, us);
+  data_due = deadline;
+}
+
+static void started(const uint16_t *) {
+  if (service_mode == SingleShot) return wait_for_data(0);
+  running = true;
+  running_mode = service_mode;
+  // nothing to read before the first interval is up
+  wait_for_data((uint64_t) mode_interval_ms(service_mode) * 1000);
+}
+
+static void start_measurement() {
+  if (running && running_mode == service_mode) return wait_for_data(0);
+  if (running) return issue(STOP_PERIODIC_MEASUREMENT, 0, stopped);
+
+  switch (service_mode) {
+    case Periodic:
+      return issue(START_PERIODIC_MEASUREMENT, 0, started);
+    case LowPowerPeriodic:
+      return issue(START_LOW_POWER_PERIODIC_MEASUREMENT, 0, started);
+    default:
+      return issue(MEASURE_SINGLE_SHOT, 0, started);
   }
-  printf("start_air_quality_measurement not enough time has elapsed for a new measurement.\n");
-  return 1;
 }
 
-int get_air_quality_reading(Reading *reading) {
-  printf("get_air_quality_reading checking for a new reading...\n");
-  if (queue_try_remove(&results_queue, reading)) {
-    printf("get_air_quality_reading new reading.\n");
-    return 0;
+static void handle(const SensorCommand &command) {
+  switch (command.type) {
+    case WakeUp:
+      return issue(WAKE_UP, 0, woken);
+    case Start:
+      sampling = true;
+      service_mode = command.mode;
+      service_interval_ms = command.interval_ms;
+      next_sample = get_absolute_time();
+      failed_samples = 0;
+      break;
+    case Stop:
+      sampling = false;
+      break;
+    case Pause:
+      sampling = false;
+      return rest();
+    case SetInterval:
+      // takes effect after the next sample
+      service_interval_ms = command.interval_ms;
+      break;
+    case Recalibrate:
+      recalibration_ppm = command.co2_ppm;
+      break;
   }
-  printf("get_air_quality_reading no data.\n");
-  return 1;
+  // the sensor has nothing new for us before its own interval is up
+  if (service_interval_ms < mode_interval_ms(service_mode)) service_interval_ms = mode_interval_ms(service_mode);
+
+  if (!sampling && running) return issue(STOP_PERIODIC_MEASUREMENT, 0, stopped);
+  rest();
+}
+
+// Moves the service along until it has to wait for something. Commands from
+// the main loop are only taken between sensor commands, so none is ever cut
+// short.
+static void run() {
+  while (true) {
+    SensorCommand command;
+    if ((step == Resting || step == Waiting) && commands.pop(&command)) {
+      handle(command);
+      continue;
+    }
+    if (step == Resting || !time_reached(deadline)) return;
+
+    switch (step) {
+      case Waiting:
+        next_sample = make_timeout_time_ms(service_interval_ms);
+        sample_pending = true;
+        TRACE_DEBUG(SENSOR_MEASURE, service_mode);
+        start_measurement();
+        break;
+      case Executing:
+        complete();
+        break;
+      case BackingOff:
+        send_in_flight();
+        break;
+      case Measuring:
+        issue(GET_DATA_READY_STATUS, 0, data_ready);
+        break;
+      default:
+        return;
+    }
+  }
+}
+
+// the alarm interrupt, on core0
+static void sensor_service(uint alarm_num) {
+  do {
+    run();
+    // set_target says so if the deadline went by while we ran
+  } while (step != Resting && hardware_alarm_set_target(sensor_alarm, deadline));
+  if (step == Resting) hardware_alarm_cancel(sensor_alarm);
+}
+
+// With interrupts off the service can't be halfway through a run, and it
+// puts its own deadline back once the kick has got it going.
+static void kick() {
+  uint32_t interrupts = save_and_disable_interrupts();
+  while (hardware_alarm_set_target(sensor_alarm, make_timeout_time_us(KICK_US))) {}
+  restore_interrupts(interrupts);
+}
+
+static void send(const SensorCommand &command) {
+  // the service only stops taking commands while the sensor executes one
+  while (!commands.push(command)) sleep_ms(SERVICE_IDLE_MS);
+  kick();
+}
+
+void init_sensor() {
+  sensor_alarm = hardware_alarm_claim_unused(true);
+  hardware_alarm_set_callback(sensor_alarm, sensor_service);
+  send({WakeUp, SingleShot, 0, 0});
+  TRACE_INFO(SENSOR_SERVICE_STARTED);
+}
+
+void sensor_start(uint32_t interval_ms, SensorMode mode) {
+  send({Start, mode, 0, interval_ms});
+}
+
+void sensor_start(uint32_t interval_ms) {
+  sensor_start(interval_ms, sensor_mode_for_interval(interval_ms));
+}
+
+void sensor_stop() {
+  send({Stop, SingleShot, 0, 0});
+}
+
+void sensor_pause() {
+  send({Pause, SingleShot, 0, 0});
+}
+
+void sensor_set_interval(uint32_t interval_ms) {
+  send({SetInterval, SingleShot, 0, interval_ms});
+}
+
+void sensor_recalibrate(uint16_t co2_ppm) {
+  send({Recalibrate, SingleShot, co2_ppm, 0});
 }
 
-bool sensor_is_active() {
-  return sensor_active;
+int sensor_read_samples(SensorSample *out, int max) {
+  return samples.pop(out, max);
 }
@@ -1,6 +1,55 @@
+#pragma once
+
 #include "state.hpp"
 
+// The sensor runs as a state machine on a timer alarm interrupt on core0. Each
+// sensor command is a step, written over I2C and then left to execute until
+// the alarm brings the machine back to read its response, so nothing ever
+// blocks for the seconds a measurement takes. Responses are CRC checked and a
+// command that fails is retried with backoff. The main loop queues commands to
+// it and collects the samples it streams back; both directions go through
+// lock-free rings, so neither side waits on the other.
+
+// as many samples as the service holds for the main loop, which takes them all
+// at once
+#define SENSOR_SAMPLE_BATCH 32
+
+enum SensorMode : uint8_t {
+    // a sample every 5 s at about 15 mA
+    Periodic,
+    // a sample every 30 s at about 3.2 mA
+    LowPowerPeriodic,
+    // one sample on request, 5 s at periodic current, idle in between
+    SingleShot
+};
+
+struct SensorSample {
+    // ms since boot when the sample was read
+    uint32_t time;
+    Reading reading;
+};
+
+// the mode that draws the least charge for a sample every interval_ms
+SensorMode sensor_mode_for_interval(uint32_t interval_ms);
+
+// wakes the sensor up and sets the service going
 void init_sensor();
-int start_air_quality_measurement();
-int get_air_quality_reading(Reading* reading);
-bool sensor_is_active();
+
+// Samples straight away and then every interval_ms. Without a mode the
+// cheapest one for the interval is used; periodic modes keep running between
+// samples.
+void sensor_start(uint32_t interval_ms, SensorMode mode);
+void sensor_start(uint32_t interval_ms);
+void sensor_stop();
+// stops sampling, but a periodic mode goes on measuring so the next
+// sensor_start in that mode has a reading straight away
+void sensor_pause();
+void sensor_set_interval(uint32_t interval_ms);
+// forced recalibration against a known concentration, e.g. 420 ppm outdoors
+void sensor_recalibrate(uint16_t co2_ppm);
+
+// copies out up to max samples, oldest first, and returns how many. Each new
+// sample posts EVENT_SAMPLE, and a sample that is still failing after its
+// retries posts EVENT_SAMPLE_FAILED. The service never waits for room, a sample
+// that finds the ring full is dropped and traced.
+int sensor_read_samples(SensorSample *samples, int max);
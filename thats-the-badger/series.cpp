@@ -0,0 +1,184 @@
+#include <cstring>
+
+#include "series.hpp"
+
+// the first sample in full, then payload bits
+struct SeriesHeader {
+  uint16_t count;
+  uint16_t bits;
+  uint32_t time;
+  Reading reading;
+};
+
+#define PAYLOAD_BITS ((SERIES_BLOCK_BYTES - sizeof(SeriesHeader)) * 8)
+
+// After a 0 for no change, prefixes 10, 110, 1110 and 1111 pick these widths.
+// Timestamps mostly repeat their interval; a 16 bit value can move by at most
+// 17 bits of zig-zag.
+static const uint8_t TIME_WIDTHS[4] = {7, 9, 12, 32};
+static const uint8_t VALUE_WIDTHS[4] = {4, 8, 12, 17};
+
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return (int32_t) (value >> 1) ^ -(int32_t) (value & 1);
+}
+
+static int width_class(uint32_t value, const uint8_t *widths) {
+  int i = 0;
+  while (i < 3 && value >> widths[i]) ++i;
+  return i;
+}
+
+static int code_bits(uint32_t value, const uint8_t *widths) {
+  if (!value) return 1;
+  int i = width_class(value, widths);
+  return (i < 3 ? i + 2 : 4) + widths[i];
+}
+
+static void put_bits(uint8_t *payload, uint16_t *bit, uint32_t value, int count) {
+  while (count--) {
+    if (value >> count & 1) payload[*bit / 8] |= 0x80 >> (*bit % 8);
+    ++*bit;
+  }
+}
+
+static void put_code(uint8_t *payload, uint16_t *bit, uint32_t value, const uint8_t *widths) {
+  if (!value) return put_bits(payload, bit, 0, 1);
+  int i = width_class(value, widths);
+  if (i < 3) {
+    put_bits(payload, bit, ((1u << (i + 1)) - 1) << 1, i + 2);
+  } else {
+    put_bits(payload, bit, 0xf, 4);
+  }
+  put_bits(payload, bit, value, widths[i]);
+}
+
+static int32_t value_delta(const Reading &from, const Reading &to, int metric) {
+  switch (metric) {
+    case 0: return (int32_t) to.co2 - from.co2;
+    case 1: return (int32_t) to.temperature - from.temperature;
+    default: return (int32_t) to.humidity - from.humidity;
+  }
+}
+
+static void add_delta(Reading *reading, int metric, int32_t delta) {
+  switch (metric) {
+    case 0: reading->co2 += delta; break;
+    case 1: reading->temperature += delta; break;
+    default: reading->humidity += delta; break;
+  }
+}
+
+#define VALUE_COUNT 3
+
+bool SeriesEncoder::append(uint32_t time, const Reading &reading) {
+  SeriesHeader header;
+  memcpy(&header, block, sizeof(header));
+  if (!count()) {
+    header = {1, 0, time, reading};
+    memcpy(block, &header, sizeof(header));
+    last_time = time;
+    last_delta = 0;
+    last = reading;
+    return true;
+  }
+
+  // in wrapping arithmetic, any step from one uint32_t time to the next decodes
+  uint32_t delta = time - last_time;
+  uint32_t time_code = zigzag((int32_t) (delta - last_delta));
+  uint32_t value_codes[VALUE_COUNT];
+  uint32_t needed = code_bits(time_code, TIME_WIDTHS);
+  for (int v = 0; v < VALUE_COUNT; ++v) {
+    value_codes[v] = zigzag(value_delta(last, reading, v));
+    needed += code_bits(value_codes[v], VALUE_WIDTHS);
+  }
+  if (header.bits + needed > PAYLOAD_BITS) return false;
+
+  uint8_t *payload = block + sizeof(header);
+  put_code(payload, &header.bits, time_code, TIME_WIDTHS);
+  for (int v = 0; v < VALUE_COUNT; ++v) put_code(payload, &header.bits, value_codes[v], VALUE_WIDTHS);
+  ++header.count;
+  memcpy(block, &header, sizeof(header));
+
+  last_time = time;
+  last_delta = delta;
+  last = reading;
+  return true;
+}
+
+void SeriesEncoder::clear() {
+  memset(block, 0, sizeof(block));
+}
+
+uint16_t SeriesEncoder::count() const {
+  SeriesHeader header;
+  memcpy(&header, block, sizeof(header));
+  return header.count;
+}
+
+uint32_t SeriesEncoder::first_time() const {
+  SeriesHeader header;
+  memcpy(&header, block, sizeof(header));
+  return header.time;
+}
+
+uint16_t SeriesEncoder::size() const {
+  SeriesHeader header;
+  memcpy(&header, block, sizeof(header));
+  return header.count ? sizeof(header) + (header.bits + 7) / 8 : 0;
+}
+
+bool SeriesDecoder::start(const uint8_t *data, uint16_t length) {
+  SeriesHeader header;
+  remaining = 0;
+  if (length < sizeof(header)) return false;
+  memcpy(&header, data, sizeof(header));
+  if (header.bits > PAYLOAD_BITS || length != sizeof(header) + (header.bits + 7) / 8) return false;
+  block = data;
+  remaining = header.count;
+  bit = 0;
+  first = true;
+  time = header.time;
+  delta = 0;
+  reading = header.reading;
+  return true;
+}
+
+uint32_t SeriesDecoder::bits(int count) {
+  const uint8_t *payload = block + sizeof(SeriesHeader);
+  uint32_t value = 0;
+  while (count--) {
+    value = value << 1 | (payload[bit / 8] >> (7 - bit % 8) & 1);
+    ++bit;
+  }
+  return value;
+}
+
+bool SeriesDecoder::next(uint32_t *time_out, Reading *reading_out) {
+  if (!remaining) return false;
+  --remaining;
+
+  if (!first) {
+    for (int v = -1; v < VALUE_COUNT; ++v) {
+      const uint8_t *widths = v < 0 ? TIME_WIDTHS : VALUE_WIDTHS;
+      int ones = 0;
+      while (ones < 4 && bits(1)) ++ones;
+      if (!ones) continue;
+      int32_t change = unzigzag(bits(widths[ones - 1]));
+      if (v < 0) {
+        delta += (uint32_t) change;
+      } else {
+        add_delta(&reading, v, change);
+      }
+    }
+    time += delta;
+  }
+  first = false;
+
+  *time_out = time;
+  *reading_out = reading;
+  return true;
+}
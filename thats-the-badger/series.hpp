@@ -0,0 +1,55 @@
+#pragma once
+
+#include "state.hpp"
+
+// Compressed blocks of readings, Gorilla style. A block starts with its first
+// sample in full; after that each sample is a bit-packed delta of delta of its
+// timestamp and, per metric, a zig-zag delta from the previous value. Each
+// goes in the smallest of a few prefixed widths, and a repeat takes one bit. On
+// the even sample interval, with readings that drift, a sample takes about
+// four bytes where a flash log record of it takes 24.
+//
+// Blocks are decoded as a stream, straight from wherever they are kept, so
+// reading them back never needs more RAM than one decoder.
+
+#define SERIES_BLOCK_BYTES 128
+
+// Fills one block in RAM. It is sealed by copying data() out and clearing.
+class SeriesEncoder {
+public:
+  // false if the block is full, the sample then has to start a new one
+  bool append(uint32_t time, const Reading &reading);
+  void clear();
+
+  uint16_t count() const;
+  uint32_t first_time() const;
+  // the block so far, in the format SeriesDecoder reads
+  const uint8_t *data() const { return block; }
+  uint16_t size() const;
+
+private:
+  uint8_t block[SERIES_BLOCK_BYTES];
+  uint32_t last_time = 0;
+  uint32_t last_delta = 0;
+  Reading last;
+};
+
+// Reads a block back, oldest sample first.
+class SeriesDecoder {
+public:
+  // false if length doesn't fit the block's header. The block has to stay put
+  // while it is read, and samples appended after this aren't seen.
+  bool start(const uint8_t *block, uint16_t length);
+  bool next(uint32_t *time, Reading *reading);
+
+private:
+  uint32_t bits(int count);
+
+  const uint8_t *block = nullptr;
+  uint16_t remaining = 0;
+  uint16_t bit = 0;
+  bool first = false;
+  uint32_t time = 0;
+  uint32_t delta = 0;
+  Reading reading;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Text short enough to live on the stack, for numbers and labels that get
+// drawn on every refresh. Formatting never touches the heap, and anything
+// under 16 bytes also fits std::string's inline buffer on the way to the
+// drawing calls. Appends past the end are cut off.
+class ShortText {
+public:
+  static const int CAPACITY = 15;
+
+  ShortText() = default;
+  explicit ShortText(const char *text) { append(text); }
+
+  const char *c_str() const { return text; }
+  int size() const { return length; }
+
+  ShortText &append(const char *more) {
+    while (*more && length < CAPACITY) text[length++] = *more++;
+    text[length] = 0;
+    return *this;
+  }
+
+  ShortText &append(char c) {
+    if (length < CAPACITY) text[length++] = c;
+    text[length] = 0;
+    return *this;
+  }
+
+  ShortText &operator+=(const char *more) { return append(more); }
+
+private:
+  char text[CAPACITY + 1] = {};
+  uint8_t length = 0;
+};
+
+inline ShortText format_int(int32_t value) {
+  char digits[10];
+  int count = 0;
+  // in unsigned so INT32_MIN negates cleanly
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t) value : (uint32_t) value;
+  do {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude);
+
+  ShortText text;
+  if (value < 0) text.append('-');
+  while (count) text.append(digits[--count]);
+  return text;
+}
+
+// numerator / denominator to the nearest whole number, ties to even like
+// printf's %.0f, for fixed point values with a positive denominator
+inline ShortText format_ratio(int32_t numerator, int32_t denominator) {
+  int32_t quotient = numerator / denominator;
+  int32_t twice_remainder = 2 * (numerator % denominator);
+  if (twice_remainder > denominator || (twice_remainder == denominator && quotient % 2)) ++quotient;
+  if (twice_remainder < -denominator || (twice_remainder == -denominator && quotient % 2)) --quotient;
+  return format_int(quotient);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// The RP2040 has no data cache, so there the indices only need their own
+// words; on the host the sim runs on, they get a cache line each so the two
+// sides don't keep stealing one line from each other.
+#ifndef SPSC_RING_LINE
+#if defined(__ARM_ARCH_6M__)
+#define SPSC_RING_LINE 4
+#else
+#define SPSC_RING_LINE 64
+#endif
+#endif
+
+// Lock-free ring between one producer and one consumer, such as the two cores
+// or an interrupt and the code it interrupts. Only the producer moves head and
+// only the consumer moves tail, so neither side ever blocks the other. Both
+// count up forever and wrap. Each side keeps the last index it saw of the
+// other's and only loads it again once that no longer leaves room.
+//
+// Only plain loads and stores, the M0+ has no atomic read-modify-write.
+template <typename T, uint32_t N>
+class SpscRing {
+  static_assert(N && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+public:
+  // producer side: as many of the items as fit, returns how many
+  uint32_t push(const T *in, uint32_t count) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (count > N - (h - tail_seen)) tail_seen = tail.load(std::memory_order_acquire);
+    uint32_t room = N - (h - tail_seen);
+    if (count > room) count = room;
+    for (uint32_t i = 0; i < count; ++i) items[(h + i) & (N - 1)] = in[i];
+    head.store(h + count, std::memory_order_release);
+    return count;
+  }
+
+  // false if the ring is full
+  bool push(const T &item) {
+    return push(&item, 1) == 1;
+  }
+
+  // For a producer that mustn't wait: whatever doesn't fit is dropped and
+  // counted instead.
+  uint32_t push_or_drop(const T *in, uint32_t count) {
+    uint32_t pushed = push(in, count);
+    if (pushed < count) drops.store(drops.load(std::memory_order_relaxed) + count - pushed, std::memory_order_relaxed);
+    return pushed;
+  }
+
+  bool push_or_drop(const T &item) {
+    return push_or_drop(&item, 1) == 1;
+  }
+
+  bool full() {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail_seen == N) tail_seen = tail.load(std::memory_order_acquire);
+    return h - tail_seen == N;
+  }
+
+  // consumer side, false if the ring is empty
+  bool pop(T *item) {
+    return pop(item, 1) == 1;
+  }
+
+  // takes up to max items in one go
+  uint32_t pop(T *out, uint32_t max) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (head_seen - t < max) head_seen = head.load(std::memory_order_acquire);
+    uint32_t count = head_seen - t;
+    if (count > max) count = max;
+    for (uint32_t i = 0; i < count; ++i) out[i] = items[(t + i) & (N - 1)];
+    tail.store(t + count, std::memory_order_release);
+    return count;
+  }
+
+  // items push_or_drop has had to drop, from either side
+  uint32_t dropped() const {
+    return drops.load(std::memory_order_relaxed);
+  }
+
+private:
+  // the producer's line
+  alignas(SPSC_RING_LINE) std::atomic<uint32_t> head{0};
+  uint32_t tail_seen = 0;
+  std::atomic<uint32_t> drops{0};
+
+  // the consumer's
+  alignas(SPSC_RING_LINE) std::atomic<uint32_t> tail{0};
+  uint32_t head_seen = 0;
+
+  alignas(SPSC_RING_LINE) T items[N];
+};
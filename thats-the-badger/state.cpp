@@ -1,33 +1,75 @@
 #include <cstring>
-#include <cstdio>
 #include "pico/platform.h"
 
-#include "hardware/flash.h"
-#include "hardware/sync.h"
+#include "flash_log.hpp"
 #include "state.hpp"
 
-#define FLASH_TARGET_OFFSET (256 * 1024)
+#define RECORD_STATE 1
+#define RECORD_SCREEN 2
+#define RECORD_CHART_RANGE 4
+#define RECORD_CLOCK 5
+#define RECORD_BATTERY_FITTED 6
 
-void store_state(const State* data)
+static FlashLog state_log = FLASH_LOG(STATE_LOG_OFFSET, STATE_LOG_SECTORS, true);
+
+// what replaying the log would give us right now
+static State persisted = State();
+
+static void apply_record(uint8_t type, const uint8_t *payload, uint16_t length, void *context) {
+  auto *state = (State *) context;
+  switch (type) {
+    case RECORD_STATE:
+      if (length == sizeof(State) && ((const State *) payload)->magic == State().magic) {
+        memcpy(state, payload, sizeof(State));
+      }
+      break;
+    case RECORD_SCREEN:
+      if (length == sizeof(Screen)) state->current_screen = (Screen) payload[0];
+      break;
+    case RECORD_CHART_RANGE:
+      if (length == sizeof(ChartRange)) state->chart_range = (ChartRange) payload[0];
+      break;
+    case RECORD_CLOCK:
+      if (length == sizeof(uint32_t)) memcpy(&state->clock, payload, sizeof(uint32_t));
+      break;
+    case RECORD_BATTERY_FITTED:
+      if (length == sizeof(uint32_t)) memcpy(&state->battery_fitted, payload, sizeof(uint32_t));
+      break;
+  }
+}
+
+static void checkpoint(const State *state) {
+  flash_log_checkpoint(&state_log, RECORD_STATE, state, sizeof(State));
+  persisted = *state;
+}
+
+void store_state(const State *state)
 {
-  uint32_t len = sizeof(State);
+  if (state->current_screen != persisted.current_screen) {
+    if (!flash_log_append(&state_log, RECORD_SCREEN, &state->current_screen, sizeof(Screen))) return checkpoint(state);
+    persisted.current_screen = state->current_screen;
+  }
 
-  if (len > FLASH_BLOCK_SIZE) len = FLASH_BLOCK_SIZE;
+  if (state->chart_range != persisted.chart_range) {
+    if (!flash_log_append(&state_log, RECORD_CHART_RANGE, &state->chart_range, sizeof(ChartRange))) return checkpoint(state);
+    persisted.chart_range = state->chart_range;
+  }
 
-  const uint32_t page_count = (len / FLASH_PAGE_SIZE) + 1;
-  const uint32_t sector_count = ((page_count * FLASH_PAGE_SIZE) / FLASH_SECTOR_SIZE) + 1;
+  if (state->clock != persisted.clock) {
+    if (!flash_log_append(&state_log, RECORD_CLOCK, &state->clock, sizeof(uint32_t))) return checkpoint(state);
+    persisted.clock = state->clock;
+  }
 
-  uint32_t ints = save_and_disable_interrupts();
-  flash_range_erase(FLASH_TARGET_OFFSET, FLASH_SECTOR_SIZE * sector_count);
-  flash_range_program(FLASH_TARGET_OFFSET, (uint8_t *) data, FLASH_PAGE_SIZE * page_count);
-  restore_interrupts(ints);
+  if (state->battery_fitted != persisted.battery_fitted) {
+    if (!flash_log_append(&state_log, RECORD_BATTERY_FITTED, &state->battery_fitted, sizeof(uint32_t))) return checkpoint(state);
+    persisted.battery_fitted = state->battery_fitted;
+  }
 }
 
 void get_state(State* state)
 {
-  const auto* data = (const State*)(XIP_BASE + FLASH_TARGET_OFFSET);
-  printf("0x%X", data->magic);
-  if (data->magic == 0x6023) {
-    memcpy(state, data, sizeof(State));
-  }
+  State replayed = State();
+  flash_log_replay(&state_log, apply_record, &replayed);
+  memcpy(state, &replayed, sizeof(State));
+  persisted = replayed;
 }
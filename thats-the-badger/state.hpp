@@ -1,22 +1,30 @@
-#include <array>
+#pragma once
 
 #include "pico/platform.h"
 
-#define READING_SAMPLE_COUNT 32
-
 enum Screen : uint8_t {
     None,
     Badge,
     AirQuality,
-    Contact
+    Contact,
+    // phase timings, only down gets here
+    Timings
+};
+
+enum ChartRange : uint8_t {
+    LastHour,
+    LastDay,
+    LastWeek
 };
 
+// Fixed point, as the sensor reports it: ppm, hundredths of a degree C and
+// hundredths of a percent RH. Only drawing converts to display units.
 class Reading {
 public:
     Reading() = default;
-    float co2 = 0;
-    float temperature = 0;
-    float humidity = 0;
+    uint16_t co2 = 0;
+    int16_t temperature = 0;
+    uint16_t humidity = 0;
 };
 
 class State {
@@ -26,9 +34,14 @@ public:
     uint16_t magic = 0x6023;
 
     Screen current_screen = Badge;
+    ChartRange chart_range = LastHour;
+
+    // a recent scheduled wake in seconds since 1970, so the clock can pick up
+    // from about there after the battery has been out
+    uint32_t clock = 0;
 
-    std::array<Reading, READING_SAMPLE_COUNT> readings = {};
-    uint8_t reading_index = 0;
+    // when a fresh battery went in, the governor plans its runtime from there
+    uint32_t battery_fitted = 0;
 };
 
 void store_state(const State *data);
@@ -0,0 +1,37 @@
+#include <cstdio>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "trace.hpp"
+
+#if TRACE_LEVEL > TRACE_LEVEL_OFF
+
+static_assert(sizeof(TraceRecord) == 16, "the decoder expects 16 byte records");
+
+// The main loop and the sensor's alarm interrupt both write, with interrupts
+// off for the few stores a record takes so neither lands inside the other.
+static TraceRecord ring[TRACE_RING_RECORDS];
+static uint32_t head;
+
+void trace_write(TraceEvent event, int32_t a, int32_t b) {
+  uint32_t interrupts = save_and_disable_interrupts();
+  ring[head % TRACE_RING_RECORDS] = {time_us_32(), event, (uint16_t) head, a, b};
+  ++head;
+  restore_interrupts(interrupts);
+}
+
+// the lines still name the core, everything runs on core0
+void trace_dump() {
+  trace_write(TRACE_TRACE_DUMP);
+  printf("trace dump\n");
+  uint32_t last = head;
+  uint32_t first = last > TRACE_RING_RECORDS ? last - TRACE_RING_RECORDS : 0;
+  for (uint32_t i = first; i < last; ++i) {
+    const uint8_t *bytes = (const uint8_t *) &ring[i % TRACE_RING_RECORDS];
+    printf("trace 0 ");
+    for (size_t j = 0; j < sizeof(TraceRecord); ++j) printf("%02x", bytes[j]);
+    printf("\n");
+  }
+}
+
+#endif
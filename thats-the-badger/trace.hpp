@@ -0,0 +1,68 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// Binary tracing into a RAM ring. A record is a timestamp, an event id and two
+// arguments, 16 bytes, with no formatting on the badge: the text for each
+// event lives in trace_events.h and only tools/trace_decode.py ever renders
+// it. The ring survives deep sleep, so a dump shows the wakes that led up to
+// it.
+//
+// TRACE_LEVEL picks what gets compiled in. Calls above it compile to nothing,
+// and at TRACE_LEVEL_OFF so does the ring itself.
+
+#define TRACE_LEVEL_OFF 0
+#define TRACE_LEVEL_ERROR 1
+#define TRACE_LEVEL_INFO 2
+#define TRACE_LEVEL_DEBUG 3
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_LEVEL_INFO
+#endif
+
+#define TRACE_RING_RECORDS 256
+
+enum TraceEvent : uint16_t {
+#define TRACE_EVENT(level, name, format) TRACE_##name,
+#include "trace_events.h"
+#undef TRACE_EVENT
+  TRACE_EVENT_COUNT
+};
+
+struct TraceRecord {
+  // us since boot, the timer stops in deep sleep
+  uint32_t time;
+  uint16_t event;
+  // count of records written, to spot what the ring overwrote
+  uint16_t sequence;
+  int32_t a;
+  int32_t b;
+};
+
+#if TRACE_LEVEL > TRACE_LEVEL_OFF
+void trace_write(TraceEvent event, int32_t a = 0, int32_t b = 0);
+
+// writes a "trace dump" line and then the ring, oldest first, to stdio as
+// "trace <core> <hex record>" lines for tools/trace_decode.py
+void trace_dump();
+#else
+inline void trace_dump() {}
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_ERROR
+#define TRACE_ERROR(name, ...) trace_write(TRACE_##name, ##__VA_ARGS__)
+#else
+#define TRACE_ERROR(name, ...) ((void) 0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_INFO
+#define TRACE_INFO(name, ...) trace_write(TRACE_##name, ##__VA_ARGS__)
+#else
+#define TRACE_INFO(name, ...) ((void) 0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_DEBUG
+#define TRACE_DEBUG(name, ...) trace_write(TRACE_##name, ##__VA_ARGS__)
+#else
+#define TRACE_DEBUG(name, ...) ((void) 0)
+#endif
@@ -0,0 +1,38 @@
+// Every trace event: level, name and the host-side format for its two
+// arguments. tools/trace_decode.py reads this file, so keep one per line and
+// only ever append: the ids are the order.
+
+TRACE_EVENT(INFO, BOOT, "boot")
+TRACE_EVENT(INFO, STATE_LOADED, "state loaded, screen %d chart range %d")
+TRACE_EVENT(INFO, HISTORY_LOADED, "history loaded, latest %t temperature %d centi-C")
+TRACE_EVENT(INFO, CLOCK_SET, "clock set to %t, persisted %t")
+TRACE_EVENT(INFO, WAKE, "wake by buttons %x at %t")
+TRACE_EVENT(INFO, SCREEN, "screen %d chart range %d")
+TRACE_EVENT(DEBUG, DRAW, "draw screen %d")
+TRACE_EVENT(DEBUG, REFRESH, "refresh screen %d")
+TRACE_EVENT(DEBUG, CHART_LIMITS, "chart limits %d to %d")
+TRACE_EVENT(INFO, STORE_STATE, "store state, screen %d chart range %d")
+TRACE_EVENT(INFO, SLEEP, "sleep until %t")
+TRACE_EVENT(INFO, TRACE_DUMP, "trace dump")
+TRACE_EVENT(INFO, SENSOR_SERVICE_STARTED, "sensor service started")
+TRACE_EVENT(DEBUG, SENSOR_MEASURE, "sensor measuring in mode %d")
+TRACE_EVENT(DEBUG, SENSOR_NOT_READY, "sensor not ready")
+TRACE_EVENT(INFO, SENSOR_READING, "sensor co2 %dppm temperature %d centi-C")
+TRACE_EVENT(INFO, SENSOR_HUMIDITY, "sensor humidity %d centi-%%RH")
+TRACE_EVENT(ERROR, SENSOR_STOP_FAILED, "sensor stop failed, error %d")
+TRACE_EVENT(ERROR, SENSOR_START_FAILED, "sensor start in mode %d failed, error %d")
+TRACE_EVENT(ERROR, SENSOR_READY_FAILED, "sensor data ready status failed, error %d")
+TRACE_EVENT(ERROR, SENSOR_READ_FAILED, "sensor read measurement failed, error %d")
+TRACE_EVENT(ERROR, SENSOR_INVALID_SAMPLE, "sensor gave an invalid sample")
+TRACE_EVENT(INFO, SENSOR_RECALIBRATED, "sensor recalibrated to %dppm, correction %d")
+TRACE_EVENT(ERROR, SENSOR_RECALIBRATION_FAILED, "sensor recalibration to %dppm failed")
+TRACE_EVENT(DEBUG, SENSOR_RETRY, "sensor command %x failed with %d, retrying")
+TRACE_EVENT(ERROR, SENSOR_READY_TIMEOUT, "sensor data not ready %d ms after it was due")
+TRACE_EVENT(DEBUG, DRAW_WIDGET, "draw screen %d widget %d")
+TRACE_EVENT(INFO, BATTERY_FITTED, "fresh battery, %d mV %d%%")
+TRACE_EVENT(INFO, GOVERNOR_PLAN, "governor level %d (-1 on USB), battery %d mV")
+TRACE_EVENT(ERROR, SENSOR_SAMPLE_DROPPED, "sensor sample dropped, ring full, %d dropped so far")
+TRACE_EVENT(ERROR, SENSOR_SAMPLE_FAILED, "sensor sample failed %d times, giving up until the next interval")
+TRACE_EVENT(ERROR, SAMPLE_WAIT_TIMEOUT, "no sample %d s into the wake, going back to sleep")
+TRACE_EVENT(ERROR, GLYPH_ATLAS_MISMATCH, "glyph face %d drew differently from the library from column %d")
+TRACE_EVENT(ERROR, GLYPH_ATLAS_WIDTH_MISMATCH, "glyph face %d measured %d px wider than the library")
@@ -0,0 +1,95 @@
+#include "wake.hpp"
+#include "events.hpp"
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/rtc.h"
+#include "hardware/structs/scb.h"
+#include "hardware/sync.h"
+
+// days since 1970-01-01 to a proleptic Gregorian date and back
+static void civil_from_days(int32_t z, int16_t *year, int8_t *month, int8_t *day) {
+  z += 719468;
+  int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+  uint32_t doe = (uint32_t) (z - era * 146097);
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  uint32_t mp = (5 * doy + 2) / 153;
+  *day = doy - (153 * mp + 2) / 5 + 1;
+  *month = mp < 10 ? mp + 3 : mp - 9;
+  *year = yoe + era * 400 + (*month <= 2);
+}
+
+static int32_t days_from_civil(int32_t year, uint32_t month, uint32_t day) {
+  year -= month <= 2;
+  int32_t era = (year >= 0 ? year : year - 399) / 400;
+  uint32_t yoe = (uint32_t) (year - era * 400);
+  uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t) doe - 719468;
+}
+
+static datetime_t to_datetime(uint32_t time) {
+  datetime_t t;
+  int32_t days = time / 86400;
+  uint32_t seconds = time % 86400;
+  civil_from_days(days, &t.year, &t.month, &t.day);
+  // 1970-01-01 was a Thursday
+  t.dotw = (days + 4) % 7;
+  t.hour = seconds / 3600;
+  t.min = seconds / 60 % 60;
+  t.sec = seconds % 60;
+  return t;
+}
+
+void clock_init(uint32_t now) {
+  rtc_init();
+  datetime_t t = to_datetime(now);
+  rtc_set_datetime(&t);
+  // the new time takes a few RTC cycles to show up in reads
+  sleep_us(64);
+}
+
+uint32_t clock_now() {
+  datetime_t t;
+  if (!rtc_get_datetime(&t)) return 0;
+  return (uint32_t) days_from_civil(t.year, t.month, t.day) * 86400 + t.hour * 3600 + t.min * 60 + t.sec;
+}
+
+static void on_alarm() {
+  events_post(EVENT_ALARM);
+}
+
+uint32_t wake_sleep_until(uint32_t wake_time, uint32_t buttons) {
+  if ((int32_t) (wake_time - clock_now()) <= 0) return 0;
+
+  // presses from before we slept were the loop's to take, and listening again
+  // restarts the debounce the stopped timer can't time
+  events_take_edges(buttons);
+  events_take(EVENT_ALARM | EVENT_BUTTONS);
+  datetime_t t = to_datetime(wake_time);
+  rtc_set_alarm(&t, on_alarm);
+  for (uint gpio = 0; gpio < 32; ++gpio) {
+    if (buttons & (1u << gpio)) events_listen_rise(gpio, EVENT_BUTTONS);
+  }
+
+  // everything but the RTC and the button interrupts stops while we sleep
+  clocks_hw->sleep_en0 = CLOCKS_SLEEP_EN0_CLK_RTC_RTC_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_IO_BITS |
+                         CLOCKS_SLEEP_EN0_CLK_SYS_PADS_BITS;
+  clocks_hw->sleep_en1 = 0;
+  scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+
+  // an interrupt between the check and __wfi still wakes it, it stays pending
+  uint32_t status = save_and_disable_interrupts();
+  while (!events_take(EVENT_ALARM | EVENT_BUTTONS)) {
+    __wfi();
+    restore_interrupts(status);
+    status = save_and_disable_interrupts();
+  }
+  restore_interrupts(status);
+
+  scb_hw->scr &= ~M0PLUS_SCR_SLEEPDEEP_BITS;
+  clocks_hw->sleep_en0 = ~0u;
+  clocks_hw->sleep_en1 = ~0u;
+  rtc_disable_alarm();
+  return events_take_edges(buttons);
+}
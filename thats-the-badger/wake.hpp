@@ -0,0 +1,17 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// The Badger 2040 can only power itself back up from a button, so to sample on
+// a schedule the board stays powered and the RP2040 waits in deep sleep with
+// just the RTC and the GPIO block clocked. RAM and the sensor service survive;
+// the system timer does not run, so wall-clock time comes from the RTC.
+
+// starts the RTC at now, in seconds since 1970
+void clock_init(uint32_t now);
+uint32_t clock_now();
+
+// Deep sleeps until the RTC reaches wake_time or one of the buttons in the
+// mask is pressed. Returns the buttons that woke us, 0 for the alarm. The
+// buttons go on posting EVENT_BUTTONS afterwards, for the loop awake.
+uint32_t wake_sleep_until(uint32_t wake_time, uint32_t buttons);
@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+"""Rasterises the faces in glyph_faces.h into a glyph atlas header.
+
+usage: glyph_atlas.py <pimoroni|sim> <glyph_faces.h> <output.hpp> <font source>...
+
+Each character of each face is drawn the way Badger2040::text() would draw it
+with the pen at 0, 0, and the header holds its advance and the box of pixels it
+sets, 1bpp, column-major and band aligned like the framebuffer. The font
+sources are read for their tables:
+
+  pimoroni  the pimoroni-pico Hershey and bitmap font data, drawn the way its
+            Badger2040, hershey and bitmap libraries do
+  sim       sim/font5x7.hpp, drawn the way the simulator's stand-in does
+
+A character the renderer can't reproduce is left out of its face, and text
+with it falls back to badger.text() on the badge.
+
+Only the standard library is used so the build needs nothing beyond python3.
+"""
+
+import os
+import re
+import struct
+import sys
+
+LETTER_SPACING = 1
+# blit() shifts a column of up to 7 bands in 64 bits
+MAX_BANDS = 7
+# Atlas.first and count, Glyph.offset
+MAX_GLYPHS = 255
+MAX_POOL = 65535
+
+
+def f32(value):
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def c_div(a, b):
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def load_faces(path):
+    faces = []
+    with open(path) as f:
+        for line in f:
+            match = re.match(r'\s*GLYPH_FACE\((\w+),\s*"(\w+)",\s*([\d.]+)f?,\s*(\d+),\s*((?:"[^"]*"\s*)+)\)', line)
+            if not match:
+                continue
+            name, font, scale, thickness, literals = match.groups()
+            charset = b''
+            for literal in re.findall(r'"([^"]*)"', literals):
+                charset += re.sub(rb'\\x([0-9a-fA-F]{2})', lambda m: bytes([int(m.group(1), 16)]),
+                                  literal.encode('latin-1'))
+            faces.append((name, font, float(scale), int(thickness), characters(charset)))
+    return faces
+
+
+def characters(data):
+    out, i = [], 0
+    while i < len(data):
+        lead = data[i]
+        length = 1 if lead < 0x80 else 2 if lead & 0xe0 == 0xc0 else 3 if lead & 0xf0 == 0xe0 else 4
+        out.append(data[i:i + length])
+        i += length
+    return out
+
+
+def strip_comments(text):
+    return re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+
+
+def parse_initialiser(tokens, i):
+    """The brace initialiser at tokens[i], as nested lists. Designators are
+    dropped, numbers become ints, nullptr None, and a reference into an array
+    (name, &name[n] or name + n) a (name, n) tuple."""
+    if tokens[i] != '{':
+        raise ValueError('expected {')
+    items, i = [], i + 1
+    while tokens[i] != '}':
+        if tokens[i] == '.':
+            i += 3
+        if tokens[i] == '{':
+            item, i = parse_initialiser(tokens, i)
+        else:
+            expr = []
+            while tokens[i] not in (',', '}'):
+                expr.append(tokens[i])
+                i += 1
+            item = parse_expression(expr)
+        items.append(item)
+        if tokens[i] == ',':
+            i += 1
+    return items, i + 1
+
+
+def parse_expression(expr):
+    if len(expr) == 1 and re.match(r'-?(0x[0-9a-fA-F]+|\d+)$', expr[0]):
+        return int(expr[0], 0)
+    if expr in (['nullptr'], ['NULL']):
+        return None
+    names = [t for t in expr if re.match(r'[A-Za-z_]\w*$', t)]
+    numbers = [int(t, 0) for t in expr if re.match(r'-?(0x[0-9a-fA-F]+|\d+)$', t)]
+    if len(names) != 1:
+        raise ValueError('unsupported expression ' + ' '.join(expr))
+    return names[0], numbers[0] if numbers else 0
+
+
+def load_tables(paths):
+    """Every braced definition in the sources, by name, and any string to
+    address map entries, such as the hershey font names."""
+    tables, names = {}, {}
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as f:
+            text = strip_comments(f.read())
+        tokens = re.findall(r'-?0x[0-9a-fA-F]+|-?\d+|[A-Za-z_]\w*|"[^"]*"|\S', text)
+        for i, token in enumerate(tokens):
+            if token != '{' or i < 2:
+                continue
+            # name {, name = {, name[] = {, name[n] = {
+            j = i - 1
+            if tokens[j] == '=':
+                j -= 1
+            while tokens[j] == ']':
+                while j > 0 and tokens[j] != '[':
+                    j -= 1
+                j -= 1
+            if not re.match(r'[A-Za-z_]\w*$', tokens[j]) or tokens[j - 1] in ('struct', 'namespace', 'class'):
+                continue
+            try:
+                tables.setdefault(tokens[j], parse_initialiser(tokens, i)[0])
+            except (ValueError, IndexError):
+                pass
+        for key, value in re.findall(r'\{\s*"(\w+)"\s*,\s*&\s*(\w+)\s*\}', text):
+            names[key] = value
+    return tables, names
+
+
+class Canvas:
+    def __init__(self):
+        self.pixels = set()
+
+    def rectangle(self, x, y, w, h):
+        for py in range(y, y + h):
+            for px in range(x, x + w):
+                self.pixels.add((px, py))
+
+
+class SimFonts:
+    """sim/badger2040.cpp: one 5x7 font stands in for them all, scaled in
+    whole pixels, vector fonts centred on y and bitmap fonts hanging from it."""
+
+    VECTOR = ('sans', 'sans_bold', 'gothic', 'cursive', 'cursive_bold', 'serif', 'serif_bold', 'serif_italic')
+    BITMAP = {'bitmap6': 1, 'bitmap8': 1, 'bitmap14_outline': 2}
+
+    def __init__(self, paths):
+        tables, _ = load_tables(paths)
+        self.glyphs = tables['font5x7']
+
+    def render(self, font, scale, thickness, character, canvas):
+        if font in self.VECTOR:
+            k = int(f32(f32(3 * f32(scale)) + 0.5))
+        elif font in self.BITMAP:
+            k = int(f32(f32(self.BITMAP[font] * f32(scale)) + 0.5))
+        else:
+            raise ValueError(f'the sim has no font {font}')
+        k = max(k, 1)
+        top = -(7 * k) // 2 if font in self.VECTOR else 0
+
+        x = 0
+        for c in character:
+            if ord('a') <= c <= ord('z'):
+                c -= ord('a') - ord('A')
+            if not 0x20 <= c <= 0x5f:
+                continue
+            for col, bits in enumerate(self.glyphs[c - 0x20]):
+                for row in range(7):
+                    if bits & (1 << row):
+                        canvas.rectangle(x + col * k, top + row * k, k, k)
+            x += 5 * k + LETTER_SPACING * k
+        return x
+
+
+class PimoroniFonts:
+    """pimoroni-pico: Hershey fonts are strokes drawn with Badger2040::line()
+    at the pen's thickness, bitmap fonts columns of scale sized squares."""
+
+    BITMAP = {'bitmap6': 'font6', 'bitmap8': 'font8', 'bitmap14_outline': 'font14_outline'}
+
+    def __init__(self, paths):
+        self.tables, self.hershey = load_tables(paths)
+
+    def table(self, name):
+        if name not in self.tables:
+            raise ValueError(f'no {name} among the font sources')
+        return self.tables[name]
+
+    def render(self, font, scale, thickness, character, canvas):
+        if len(character) > 1 or not 0x20 <= character[0] < 0x7f:
+            return None
+        c = character[0]
+        if font in self.hershey:
+            return self.hershey_glyph(self.table(self.hershey[font]), c, f32(scale), thickness, canvas)
+        if font in self.BITMAP:
+            return self.bitmap_character(self.table(self.BITMAP[font]), c, int(max(1.0, scale)), canvas)
+        raise ValueError(f'the Badger2040 library has no font {font}')
+
+    # hershey::glyph() with no rotation, positions truncated to int8_t
+    def hershey_glyph(self, font, c, s, thickness, canvas):
+        chars = font[0]
+        width, count, vertices = chars[c - 32]
+        name, offset = vertices if vertices else (None, 0)
+        data = self.table(name)[offset:offset + 2 * count] if name else []
+
+        def scaled(v):
+            return int(f32(v * s))
+
+        advance = int(f32(width * s))
+        if not count:
+            return advance
+        cx, cy = scaled(data[0]), scaled(data[1])
+        pen_down = True
+        for i in range(1, count):
+            vx, vy = data[2 * i], data[2 * i + 1]
+            if vx == -128 and vy == -128:
+                pen_down = False
+                continue
+            nx, ny = scaled(vx), scaled(vy)
+            if pen_down:
+                self.line(cx, cy, nx, ny, thickness, canvas)
+            cx, cy = nx, ny
+            pen_down = True
+        return advance
+
+    # Badger2040::line(), 16.16 fixed point and the end point left off, each
+    # point a thickness sized square
+    def line(self, x1, y1, x2, y2, thickness, canvas):
+        dx, dy = x2 - x1, y2 - y1
+        half = thickness // 2
+        points = []
+        if abs(dx) > abs(dy):
+            s = abs(dx)
+            sx = 1 if dx >= 0 else -1
+            sy = c_div(dy << 16, s)
+            x, y = x1, y1 << 16
+            for _ in range(s):
+                points.append((x, y >> 16))
+                x, y = x + sx, y + sy
+        elif dy:
+            s = abs(dy)
+            sy = 1 if dy >= 0 else -1
+            sx = c_div(dx << 16, s)
+            x, y = x1 << 16, y1
+            for _ in range(s):
+                points.append((x >> 16, y))
+                x, y = x + sx, y + sy
+        for x, y in points:
+            canvas.rectangle(x - half, y - half, thickness, thickness)
+
+    # bitmap::character(), bit 0 of each column at the top
+    def bitmap_character(self, font, c, scale, canvas):
+        height, max_width, widths, data = font[:4]
+        if height > 8:
+            raise ValueError('only bitmap fonts up to 8 rows tall are supported')
+        index = c - 32
+        for cx in range(widths[index]):
+            bits = data[index * max_width + cx]
+            for cy in range(height):
+                if bits & (1 << cy):
+                    canvas.rectangle(cx * scale, cy * scale, scale, scale)
+        return widths[index] * scale + LETTER_SPACING * scale
+
+
+def pack(pixels):
+    """left, top, width, bands and the column-major bytes, MSB at the top"""
+    if not pixels:
+        return 0, 0, 0, 0, b''
+    x0, x1 = min(x for x, _ in pixels), max(x for x, _ in pixels)
+    band0, band1 = min(y for _, y in pixels) // 8, max(y for _, y in pixels) // 8
+    data = bytearray()
+    for x in range(x0, x1 + 1):
+        for band in range(band0, band1 + 1):
+            byte = 0
+            for bit in range(8):
+                if (x, band * 8 + bit) in pixels:
+                    byte |= 0x80 >> bit
+            data.append(byte)
+    return x0, band0 * 8, x1 - x0 + 1, band1 - band0 + 1, bytes(data)
+
+
+def describe(character):
+    return "'" + ''.join(chr(b) if 0x20 <= b < 0x7f else f'\\x{b:02x}' for b in character) + "'"
+
+
+def main():
+    if len(sys.argv) < 5 or sys.argv[1] not in ('pimoroni', 'sim'):
+        sys.exit(__doc__)
+    renderer, faces_h, header = sys.argv[1:4]
+    fonts = (PimoroniFonts if renderer == 'pimoroni' else SimFonts)(sys.argv[4:])
+
+    pool, glyphs, lines, atlases = bytearray(), 0, [], []
+    for name, font, scale, thickness, charset in load_faces(faces_h):
+        first, left_out = glyphs, []
+        lines.append(f'// {name}, {font} at {scale:g}, thickness {thickness}')
+        for character in charset:
+            canvas = Canvas()
+            advance = fonts.render(font, scale, thickness, character, canvas)
+            if advance is None:
+                left_out.append(character)
+                continue
+            left, top, width, bands, data = pack(canvas.pixels)
+            if bands > MAX_BANDS:
+                raise ValueError(f'{name} {describe(character)} is {bands} bands tall, at most {MAX_BANDS} fit')
+            code = int.from_bytes(character, 'little')
+            lines.append(f'{{0x{code:02x}, {advance}, {left}, {top}, {width}, {bands}, {len(pool)}}},  '
+                         f'// {describe(character)}')
+            pool += data
+            glyphs += 1
+        if left_out:
+            lines.append('// left to badger.text: ' + ', '.join(describe(c) for c in left_out))
+        atlases.append((first, glyphs - first))
+
+    if glyphs > MAX_GLYPHS or len(pool) > MAX_POOL:
+        raise ValueError(f'{glyphs} glyphs in {len(pool)} bytes, at most {MAX_GLYPHS} in {MAX_POOL}')
+
+    rows = [', '.join(f'0x{b:02x}' for b in pool[i:i + 16]) for i in range(0, len(pool), 16)] or ['0']
+    with open(header, 'w') as f:
+        f.write(f'#pragma once\n// generated by tools/glyph_atlas.py from {os.path.basename(faces_h)} '
+                f'and the {renderer} fonts, do not edit\n\n')
+        f.write('#include "glyph_atlas.hpp"\n\n')
+        f.write(f'// {glyphs} glyphs, {len(pool)} bytes\n')
+        f.write('const uint8_t atlas_pool[] = {\n    ' + ',\n    '.join(rows) + '\n};\n\n')
+        f.write('const Glyph atlas_glyphs[] = {\n    ' + '\n    '.join(lines) + '\n};\n\n')
+        f.write('const Atlas atlases[FACE_COUNT] = {\n    ' +
+                ',\n    '.join(f'{{{first}, {count}}}' for first, count in atlases) + '\n};\n')
+
+if __name__ == '__main__':
+    main()
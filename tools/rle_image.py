@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Encodes a PNG as a run-length compressed 1bpp image header for image.hpp.
+
+usage: rle_image.py <image.png> <output.hpp>
+
+Pixels darker than mid grey (and not transparent) are black. The bitmap is
+row-major, MSB first, one bit per pixel with 1 for black, and is encoded as a
+stream of packets:
+
+  0x00-0x7f  n + 1 literal bytes follow
+  0x80-0xff  the next byte repeats (n & 0x7f) + 2 times
+
+Only the standard library is used so the build needs nothing beyond python3.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError(f'{path}: not a PNG')
+
+    pos, idat, palette = 8, b'', None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, colour, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+    if interlace:
+        raise ValueError(f'{path}: interlaced PNGs are not supported')
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour]
+    bpp = max(1, channels * depth // 8)
+    stride = (width * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+
+    rows, previous, i = [], bytearray(stride), 0
+    for _ in range(height):
+        kind, line = raw[i], bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = previous[x]
+            c = previous[x - bpp] if x >= bpp else 0
+            if kind == 1:
+                line[x] = (line[x] + a) & 0xff
+            elif kind == 2:
+                line[x] = (line[x] + b) & 0xff
+            elif kind == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[x] = (line[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        rows.append(bytes(line))
+        previous = line
+
+    def sample(row, x, channel):
+        if depth == 8:
+            return row[x * channels + channel]
+        shift = 8 - depth - (x * depth % 8)
+        value = (row[x * depth // 8] >> shift) & ((1 << depth) - 1)
+        return value * 255 // ((1 << depth) - 1) if colour != 3 else value
+
+    def black(row, x):
+        if colour == 3:
+            r, g, b = palette[sample(row, x, 0) * 3:sample(row, x, 0) * 3 + 3]
+            return (r + g + b) / 3 <= 128
+        grey = sum(sample(row, x, c) for c in range(3)) / 3 if colour in (2, 6) else sample(row, x, 0)
+        alpha = sample(row, x, channels - 1) if colour in (4, 6) else 255
+        return alpha >= 128 and grey <= 128
+
+    if width % 8:
+        raise ValueError(f'{path}: width must be a multiple of 8')
+    bitmap = bytearray()
+    for row in rows:
+        for x0 in range(0, width, 8):
+            byte = 0
+            for x in range(x0, x0 + 8):
+                byte = (byte << 1) | black(row, x)
+            bitmap.append(byte)
+    return width, height, bytes(bitmap)
+
+
+def encode(bitmap):
+    out, literal, i = bytearray(), bytearray(), 0
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            out.extend(literal)
+            literal.clear()
+
+    while i < len(bitmap):
+        run = 1
+        while i + run < len(bitmap) and run < MAX_REPEAT and bitmap[i + run] == bitmap[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.extend((0x80 | (run - 2), bitmap[i]))
+            i += run
+        else:
+            literal.append(bitmap[i])
+            if len(literal) == MAX_LITERAL:
+                flush()
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def decode(data, size):
+    out, i = bytearray(), 0
+    while len(out) < size:
+        n = data[i]
+        if n < 0x80:
+            out.extend(data[i + 1:i + 2 + n])
+            i += 2 + n
+        else:
+            out.extend(data[i + 1:i + 2] * ((n & 0x7f) + 2))
+            i += 2
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    png, header = sys.argv[1:]
+    name = os.path.splitext(os.path.basename(png))[0]
+    width, height, bitmap = read_png(png)
+    data = encode(bitmap)
+    assert decode(data, len(bitmap)) == bitmap
+
+    lines = [', '.join(f'0x{b:02x}' for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    with open(header, 'w') as f:
+        f.write(f'#pragma once\n// generated by tools/rle_image.py from {os.path.basename(png)}, do not edit\n\n')
+        f.write('#include "image.hpp"\n\n')
+        f.write(f'// {len(data)} bytes, {len(bitmap)} unpacked\n')
+        f.write(f'const uint8_t {name}_image_data[] = {{\n    ' + ',\n    '.join(lines) + '\n};\n\n')
+        f.write(f'const RleImage {name}_image = {{{width}, {height}, {name}_image_data}};\n')
+
+
+if __name__ == '__main__':
+    main()
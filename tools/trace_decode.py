@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Turns a trace dump from the badge into readable text.
+
+usage: trace_decode.py [dump.txt]
+
+Reads the "trace dump" and "trace <core> <hex record>" lines that trace_dump()
+writes, from the file or stdin, ignoring everything else, and prints the
+records of both cores in time order, one dump after the other. Event names and
+formats come from trace_events.h next to the firmware, so the decoder always
+matches the source it sits in. Besides the usual printf conversions, %t
+formats seconds since 1970 as a UTC time.
+"""
+
+import os
+import re
+import struct
+import sys
+import time
+
+EVENTS_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'thats-the-badger', 'trace_events.h')
+RECORD = struct.Struct('<IHHii')
+
+
+def load_events(path):
+    events = []
+    with open(path) as f:
+        for line in f:
+            match = re.match(r'\s*TRACE_EVENT\((\w+),\s*(\w+),\s*"(.*)"\)', line)
+            if match:
+                events.append(match.groups())
+    return events
+
+
+def render(text, args):
+    out, args = [], list(args)
+
+    def convert(match):
+        if match.group(0) == '%%':
+            return '%'
+        value = args.pop(0) if args else 0
+        if match.group(1) == 't':
+            return time.strftime('%Y-%m-%d %H:%M:%S', time.gmtime(value & 0xffffffff))
+        if match.group(1) == 'x':
+            return '%x' % (value & 0xffffffff)
+        return match.group(0).replace(match.group(1), 'd') % value
+
+    return re.sub(r'%%|%[-0-9]*([dtxu])', convert, text)
+
+
+def main():
+    events = load_events(EVENTS_H)
+    source = open(sys.argv[1]) if len(sys.argv) > 1 else sys.stdin
+
+    dumps, records = [], []
+    for line in source:
+        parts = line.split()
+        if parts == ['trace', 'dump']:
+            if records:
+                dumps.append(records)
+            records = []
+            continue
+        if len(parts) != 3 or parts[0] != 'trace' or len(parts[2]) != RECORD.size * 2:
+            continue
+        try:
+            fields = RECORD.unpack(bytes.fromhex(parts[2]))
+        except ValueError:
+            continue
+        records.append((int(parts[1]),) + fields)
+    if records:
+        dumps.append(records)
+
+    for index, records in enumerate(dumps):
+        if index:
+            print()
+        print_dump(records, events)
+
+
+def print_dump(records, events):
+    # the timer restarts at every power-up, but so do the rings, so within one
+    # dump time order is the order things happened
+    last_sequence = {}
+    for core, stamp, event, sequence, a, b in sorted(records, key=lambda r: r[1]):
+        gap = (sequence - last_sequence[core] - 1) & 0xffff if core in last_sequence else 0
+        last_sequence[core] = sequence
+        if gap:
+            print(f'{"":>14} core{core} ... {gap} records lost')
+        if event < len(events):
+            level, name, text = events[event]
+            message = render(text, (a, b))
+        else:
+            level, name, message = '?', f'event {event}', f'{a} {b}'
+        print(f'{stamp / 1e6:14.6f} core{core} {level:<5} {name:<28} {message}')
+
+
+if __name__ == '__main__':
+    main()